@@ -0,0 +1,84 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#include <vector>
+
+#include <vms/core/cpu.h>
+
+namespace vms::bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Pin the calling thread to @p cpu; negative values leave it unpinned. */
+    inline bool pin_current_thread(int cpu)
+    {
+        if (cpu < 0)
+        {
+            return true;
+        }
+
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+    }
+
+    /**
+     * @brief Back-off used by busy-waiting benchmark loops.
+     *
+     * On a single CPU spinning only burns the time slice the peer needs,
+     * so the hint degrades to a yield there.
+     */
+    inline void wait_hint()
+    {
+        static const bool single_cpu = std::thread::hardware_concurrency() < 2;
+
+        if (single_cpu)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            vms::core::cpu_relax();
+        }
+    }
+
+    /** @brief Integer command line argument @p idx, or @p fallback when absent. */
+    inline long long arg_or(int argc, char** argv, int idx, long long fallback)
+    {
+        return (idx < argc) ? std::atoll(argv[idx]) : fallback;
+    }
+
+    /** @brief Nanoseconds elapsed between two time points. */
+    inline double elapsed_ns(Clock::time_point begin, Clock::time_point end)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    /** @brief Value at @p quantile of @p samples (sorted in place). */
+    inline uint64_t percentile(std::vector<uint64_t>& samples, double quantile)
+    {
+        if (samples.empty())
+        {
+            return 0;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        const auto rank = static_cast<size_t>(quantile * static_cast<double>(samples.size() - 1));
+        return samples[rank];
+    }
+}
@@ -0,0 +1,315 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-bench [iterations] [cycles] [period_us] [samples]
+//
+// Release-comparison suite for the thread loop. Prints one JSON object on
+// stdout (progress goes to stderr) with:
+//
+//   loop         ns per Thread::loop() iteration around an empty run()
+//   start, stop  start() -> first run() and stop() -> joined latencies
+//   timed        TimedThread wake-up error against the requested delay
+//   hires_*      HiResTimedThread wake-up error against each deadline,
+//                for every TimerPrecision
+//
+// Latencies are reported in nanoseconds as min/mean/percentiles/max. No
+// network, no extra dependency: only the library and the C++ runtime.
+
+#include "bench_common.h"
+
+#include <vms/core/thread_worker.h>
+
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <sys/utsname.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    /** @brief Print "name": {min, mean, p50 ... max} for @p samples (sorted in place). */
+    void print_distribution(const char* name, std::vector<uint64_t>& samples, bool last = false)
+    {
+        double sum = 0.0;
+
+        for (const uint64_t sample : samples)
+        {
+            sum += static_cast<double>(sample);
+        }
+
+        const double mean = samples.empty() ? 0.0 : sum / static_cast<double>(samples.size());
+
+        // percentile() sorts, so min and max are read afterwards.
+        const auto p50 = static_cast<unsigned long long>(vms::bench::percentile(samples, 0.50));
+        const auto p90 = static_cast<unsigned long long>(vms::bench::percentile(samples, 0.90));
+        const auto p99 = static_cast<unsigned long long>(vms::bench::percentile(samples, 0.99));
+        const auto p999 = static_cast<unsigned long long>(vms::bench::percentile(samples, 0.999));
+        const auto min = static_cast<unsigned long long>(samples.empty() ? 0 : samples.front());
+        const auto max = static_cast<unsigned long long>(samples.empty() ? 0 : samples.back());
+
+        std::printf("    \"%s\": {\"samples\": %zu, \"min_ns\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %llu, "
+                    "\"p90_ns\": %llu, \"p99_ns\": %llu, \"p99_9_ns\": %llu, \"max_ns\": %llu}%s\n",
+                    name, samples.size(), min, mean, p50, p90, p99, p999, max, last ? "" : ",");
+    }
+
+    uint64_t to_ns(Clock::duration duration)
+    {
+        const auto count = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        return count > 0 ? static_cast<uint64_t>(count) : 0;
+    }
+
+    /** @brief Empty run() stopping itself after a fixed number of iterations. */
+    class LoopWorker : public vms::core::Thread
+    {
+    public:
+        explicit LoopWorker(uint64_t iterations) : iterations_(iterations) {}
+        ~LoopWorker() override { stop(); }
+
+        double ns_per_iteration() const
+        {
+            return vms::bench::elapsed_ns(begin_, end_) / static_cast<double>(iterations_);
+        }
+
+    protected:
+        bool init() override
+        {
+            begin_ = Clock::now();
+            return true;
+        }
+
+        void run() override
+        {
+            if (++done_ == iterations_)
+            {
+                end_ = Clock::now();
+                request_stop();
+            }
+        }
+
+    private:
+        uint64_t iterations_;
+        uint64_t done_ = 0;
+        Clock::time_point begin_;
+        Clock::time_point end_;
+    };
+
+    /** @brief Records when run() first executes after each start(). */
+    class StartStopWorker : public vms::core::Thread
+    {
+    public:
+        ~StartStopWorker() override { stop(); }
+
+        void arm() { first_run_.store(0, std::memory_order_release); }
+
+        bool has_run() const { return first_run_.load(std::memory_order_acquire) != 0; }
+
+        Clock::time_point first_run() const
+        {
+            return Clock::time_point(Clock::duration(first_run_.load(std::memory_order_acquire)));
+        }
+
+    protected:
+        void run() override
+        {
+            if (!has_run())
+            {
+                first_run_.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+            }
+
+            wait_for_wake();
+        }
+
+    private:
+        std::atomic<Clock::rep> first_run_{0};
+    };
+
+    /** @brief Wake-up error of a TimedThread: gap between iterations minus the delay. */
+    class TimedWorker : public vms::core::TimedThread
+    {
+    public:
+        TimedWorker(int32_t period_us, std::size_t samples)
+            : vms::core::TimedThread(period_us)
+            , delay_(std::chrono::microseconds(period_us))
+        {
+            errors_.reserve(samples);
+        }
+
+        ~TimedWorker() override { stop(); }
+
+        bool full() const { return full_.load(std::memory_order_acquire); }
+        std::vector<uint64_t>& errors() { return errors_; }
+
+    protected:
+        void run() override
+        {
+            const auto now = Clock::now();
+
+            if (previous_ != Clock::time_point{} && !full())
+            {
+                errors_.push_back(to_ns(now - previous_ - delay_));
+                full_.store(errors_.size() == errors_.capacity(), std::memory_order_release);
+            }
+
+            previous_ = now;
+        }
+
+    private:
+        Clock::duration delay_;
+        Clock::time_point previous_{};
+        std::vector<uint64_t> errors_;
+        std::atomic<bool> full_{false};
+    };
+
+    /** @brief Wake-up error of a HiResTimedThread: iteration start minus its deadline. */
+    class HiResWorker : public vms::core::HiResTimedThread
+    {
+    public:
+        HiResWorker(int32_t period_us, std::size_t samples, vms::core::TimerPrecision precision)
+            : vms::core::HiResTimedThread(period_us)
+        {
+            set_precision(precision);
+            errors_.reserve(samples);
+        }
+
+        ~HiResWorker() override { stop(); }
+
+        bool full() const { return full_.load(std::memory_order_acquire); }
+        std::vector<uint64_t>& errors() { return errors_; }
+
+    protected:
+        void run() override
+        {
+            const auto now = vms::bench::Clock::now();
+
+            // The first iteration runs immediately, it has no wake-up to measure.
+            if (iteration_context().index > 0 && !full())
+            {
+                errors_.push_back(to_ns(now - iteration_context().deadline));
+                full_.store(errors_.size() == errors_.capacity(), std::memory_order_release);
+            }
+        }
+
+    private:
+        std::vector<uint64_t> errors_;
+        std::atomic<bool> full_{false};
+    };
+
+    template <typename Worker>
+    void wait_until_full(Worker& worker)
+    {
+        while (!worker.full())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        worker.stop();
+    }
+
+    void print_metadata(long long iterations, long long cycles, long long period_us, long long samples)
+    {
+        utsname host{};
+        uname(&host);
+
+        std::printf("{\n");
+        std::printf("  \"benchmark\": \"vms-core-bench\",\n");
+        std::printf("  \"version\": \"%s\",\n", VMS_CORE_VERSION);
+        std::printf("  \"timestamp\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+        std::printf("  \"host\": {\"kernel\": \"%s\", \"machine\": \"%s\", \"cpus\": %u},\n", host.release,
+                    host.machine, std::thread::hardware_concurrency());
+        std::printf("  \"parameters\": {\"iterations\": %lld, \"cycles\": %lld, \"period_us\": %lld, "
+                    "\"samples\": %lld},\n",
+                    iterations, cycles, period_us, samples);
+        std::printf("  \"results\": {\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto iterations = vms::bench::arg_or(argc, argv, 1, 20000000);
+    const auto cycles = vms::bench::arg_or(argc, argv, 2, 2000);
+    const auto period_us = vms::bench::arg_or(argc, argv, 3, 1000);
+    const auto samples = vms::bench::arg_or(argc, argv, 4, 2000);
+
+    if (iterations <= 0 || cycles <= 0 || period_us <= 0 || samples <= 0)
+    {
+        std::fprintf(stderr, "every argument must be positive\n");
+        return 1;
+    }
+
+    print_metadata(iterations, cycles, period_us, samples);
+
+    std::fprintf(stderr, "loop overhead...\n");
+    {
+        LoopWorker worker(static_cast<uint64_t>(iterations));
+        worker.start();
+        worker.join_handle().wait();
+        std::printf("    \"loop\": {\"iterations\": %lld, \"ns_per_iteration\": %.2f},\n", iterations,
+                    worker.ns_per_iteration());
+    }
+
+    std::fprintf(stderr, "start/stop latency...\n");
+    {
+        StartStopWorker worker;
+        std::vector<uint64_t> start_latency;
+        std::vector<uint64_t> stop_latency;
+        start_latency.reserve(static_cast<std::size_t>(cycles));
+        stop_latency.reserve(static_cast<std::size_t>(cycles));
+
+        for (long long cycle = 0; cycle < cycles; ++cycle)
+        {
+            worker.arm();
+            const auto begin = Clock::now();
+            worker.start();
+
+            while (!worker.has_run())
+            {
+                vms::bench::wait_hint();
+            }
+
+            start_latency.push_back(to_ns(worker.first_run() - begin));
+
+            const auto stop_begin = Clock::now();
+            worker.stop();
+            stop_latency.push_back(to_ns(Clock::now() - stop_begin));
+        }
+
+        print_distribution("start", start_latency);
+        print_distribution("stop", stop_latency);
+    }
+
+    const auto period = static_cast<int32_t>(period_us);
+    const auto sample_count = static_cast<std::size_t>(samples);
+
+    std::fprintf(stderr, "TimedThread wake-up error...\n");
+    {
+        TimedWorker worker(period, sample_count);
+        worker.start();
+        wait_until_full(worker);
+        print_distribution("timed", worker.errors());
+    }
+
+    std::fprintf(stderr, "HiResTimedThread wake-up error (SLEEP)...\n");
+    {
+        HiResWorker worker(period, sample_count, vms::core::TimerPrecision::SLEEP);
+        worker.start();
+        wait_until_full(worker);
+        print_distribution("hires_sleep", worker.errors());
+    }
+
+    std::fprintf(stderr, "HiResTimedThread wake-up error (HYBRID)...\n");
+    {
+        HiResWorker worker(period, sample_count, vms::core::TimerPrecision::HYBRID);
+        worker.start();
+        wait_until_full(worker);
+        print_distribution("hires_hybrid", worker.errors(), true);
+    }
+
+    std::printf("  }\n}\n");
+    return 0;
+}
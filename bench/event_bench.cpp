@@ -0,0 +1,132 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-event-bench [round_trips] [signals]
+//
+// Ping-pong between two threads, ns per round trip, for Event (AUTO_RESET),
+// BinarySemaphore and the std::mutex + std::condition_variable pair they
+// replace. Then the cost of signalling when nobody waits, which is the
+// common case for a busy consumer.
+
+#include "bench_common.h"
+
+#include <vms/core/event.h>
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    /** @brief condition_variable equivalent of an AUTO_RESET Event. */
+    class CvSignal
+    {
+    public:
+        void set()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                signaled_ = true;
+            }
+
+            cv_.notify_one();
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return signaled_; });
+            signaled_ = false;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool signaled_ = false;
+    };
+
+    struct EventSignal
+    {
+        vms::core::Event event{vms::core::EventMode::AUTO_RESET};
+
+        void set() { event.set(); }
+        void wait() { event.wait(); }
+    };
+
+    struct SemaphoreSignal
+    {
+        vms::core::BinarySemaphore semaphore;
+
+        void set() { semaphore.release(); }
+        void wait() { semaphore.acquire(); }
+    };
+
+    /** @brief Nanoseconds per ping + pong between the caller and a peer thread. */
+    template <typename Signal>
+    double ping_pong(uint64_t round_trips)
+    {
+        Signal ping;
+        Signal pong;
+
+        std::thread peer([&] {
+            for (uint64_t i = 0; i < round_trips; ++i)
+            {
+                ping.wait();
+                pong.set();
+            }
+        });
+
+        const auto begin = Clock::now();
+
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            ping.set();
+            pong.wait();
+        }
+
+        const double elapsed = vms::bench::elapsed_ns(begin, Clock::now());
+        peer.join();
+
+        return elapsed / static_cast<double>(round_trips);
+    }
+
+    /** @brief Nanoseconds per set() + consume with no thread blocked on the signal. */
+    template <typename Signal>
+    double uncontended(uint64_t signals)
+    {
+        Signal signal;
+        const auto begin = Clock::now();
+
+        for (uint64_t i = 0; i < signals; ++i)
+        {
+            signal.set();
+            signal.wait();
+        }
+
+        return vms::bench::elapsed_ns(begin, Clock::now()) / static_cast<double>(signals);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto round_trips = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 100000));
+    const auto signals = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 2, 10000000));
+
+    std::printf("%llu round trips, %llu uncontended signals, ns per operation\n",
+                static_cast<unsigned long long>(round_trips), static_cast<unsigned long long>(signals));
+    std::printf("%-26s %14s %14s\n", "", "ping-pong", "uncontended");
+    std::printf("%-26s %14.1f %14.1f\n", "Event (AUTO_RESET)", ping_pong<EventSignal>(round_trips),
+                uncontended<EventSignal>(signals));
+    std::printf("%-26s %14.1f %14.1f\n", "BinarySemaphore", ping_pong<SemaphoreSignal>(round_trips),
+                uncontended<SemaphoreSignal>(signals));
+    std::printf("%-26s %14.1f %14.1f\n", "mutex + condition_variable", ping_pong<CvSignal>(round_trips),
+                uncontended<CvSignal>(signals));
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-inplace-function-bench [tasks]
+//
+// Cost of submitting a task: wrap a lambda, move it into a pre-reserved
+// batch, invoke it and destroy it, for growing capture sizes. The batch is
+// a plain vector so that queue synchronisation does not hide the cost of
+// the callable wrapper itself.
+
+#include "bench_common.h"
+
+#include <vms/core/inplace_function.h>
+
+#include <array>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    constexpr size_t batch = 256;
+
+    /** @brief Nanoseconds per submit + run of a lambda capturing @p CaptureBytes bytes. */
+    template <typename Function, size_t CaptureBytes>
+    double run_submit(uint64_t tasks, uint64_t& sink)
+    {
+        std::vector<Function> pending;
+        pending.reserve(batch);
+        std::array<uint64_t, CaptureBytes / sizeof(uint64_t)> payload{};
+
+        const auto begin = Clock::now();
+
+        for (uint64_t done = 0; done < tasks; done += batch)
+        {
+            for (size_t i = 0; i < batch; ++i)
+            {
+                payload[0] = done + i;
+                pending.emplace_back([payload, &sink] { sink += payload[0]; });
+            }
+
+            for (auto& task : pending)
+            {
+                task();
+            }
+
+            pending.clear();
+        }
+
+        return vms::bench::elapsed_ns(begin, Clock::now()) / static_cast<double>(tasks);
+    }
+
+    template <size_t CaptureBytes>
+    void run_row(uint64_t tasks)
+    {
+        uint64_t sink = 0;
+
+        // The capture also holds the reference to sink.
+        std::printf("%8zu B", CaptureBytes + sizeof(void*));
+        std::printf(" %16.1f", run_submit<vms::core::InplaceTask, CaptureBytes>(tasks, sink));
+        std::printf(" %16.1f", run_submit<std::function<void()>, CaptureBytes>(tasks, sink));
+#if defined(__cpp_lib_move_only_function)
+        std::printf(" %22.1f", run_submit<std::move_only_function<void()>, CaptureBytes>(tasks, sink));
+#else
+        std::printf(" %22s", "n/a");
+#endif
+        std::printf("\n");
+
+        if (sink == 0)
+        {
+            std::printf("unexpected empty sink\n");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto tasks = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 4000000));
+
+    std::printf("%llu tasks, ns per submit + run\n", static_cast<unsigned long long>(tasks));
+    std::printf("%10s %16s %16s %22s\n", "capture", "InplaceTask", "std::function", "std::move_only_function");
+
+    run_row<8>(tasks);
+    run_row<24>(tasks);
+    run_row<48>(tasks);
+
+    return 0;
+}
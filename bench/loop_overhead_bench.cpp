@@ -0,0 +1,189 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-loop-overhead-bench [items] [batch]
+//
+// Per-item cost of the worker loop itself. Each variant consumes the same
+// trivial items (a counter increment) and stops itself once it reaches the
+// target, so the figure is dominated by the per-iteration bookkeeping:
+//
+//   Thread        one item per virtual run() call
+//   BatchedThread up to [batch] items per run_batch() call
+//   StaticThread  one item per inlined run() call
+//   StaticThread  [batch] items per inlined run() call
+
+#include "bench_common.h"
+
+#include <vms/core/static_thread.h>
+#include <vms/core/thread_worker.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    /** @brief Item source shared by every variant: a counter and its timing. */
+    struct Items
+    {
+        uint64_t target = 0;
+        uint64_t done = 0;
+        uint64_t sink = 0;
+        Clock::time_point begin;
+        Clock::time_point end;
+        std::atomic<bool> finished{false};
+
+        /** @brief Consume up to @p budget items; true once the target is reached. */
+        bool consume(uint64_t budget)
+        {
+            const uint64_t count = std::min(budget, target - done);
+
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                sink += done + i;
+            }
+
+            done += count;
+
+            if (done < target)
+            {
+                return false;
+            }
+
+            end = Clock::now();
+            finished.store(true, std::memory_order_release);
+            return true;
+        }
+
+        double ns_per_item() const
+        {
+            return vms::bench::elapsed_ns(begin, end) / static_cast<double>(target);
+        }
+    };
+
+    class VirtualWorker : public vms::core::Thread
+    {
+    public:
+        explicit VirtualWorker(Items& items) : items_(items) {}
+        ~VirtualWorker() override { stop(); }
+
+    protected:
+        bool init() override
+        {
+            items_.begin = Clock::now();
+            return true;
+        }
+
+        void run() override
+        {
+            if (items_.consume(1))
+            {
+                request_stop();
+            }
+        }
+
+    private:
+        Items& items_;
+    };
+
+    class BatchedWorker : public vms::core::BatchedThread
+    {
+    public:
+        BatchedWorker(Items& items, std::size_t batch) : vms::core::BatchedThread(batch), items_(items) {}
+        ~BatchedWorker() override { stop(); }
+
+    protected:
+        bool init() override
+        {
+            items_.begin = Clock::now();
+            return true;
+        }
+
+        std::size_t run_batch(std::size_t budget) override
+        {
+            const uint64_t before = items_.done;
+
+            if (items_.consume(budget))
+            {
+                request_stop();
+            }
+
+            return static_cast<std::size_t>(items_.done - before);
+        }
+
+    private:
+        Items& items_;
+    };
+
+    class StaticWorker : public vms::core::StaticThread<StaticWorker>
+    {
+        friend struct vms::core::StaticThreadAccess;
+
+    public:
+        StaticWorker(Items& items, uint64_t batch) : items_(items), batch_(batch) {}
+        ~StaticWorker() { stop(); }
+
+    private:
+        bool init()
+        {
+            items_.begin = Clock::now();
+            return true;
+        }
+
+        void run()
+        {
+            if (items_.consume(batch_))
+            {
+                stop(false);
+            }
+        }
+
+        Items& items_;
+        uint64_t batch_;
+    };
+
+    /** @brief Run one worker to completion and return its ns per item. */
+    template <typename Worker, typename... Args>
+    double measure(uint64_t target, Args... args)
+    {
+        Items items;
+        items.target = target;
+
+        Worker worker(items, args...);
+        worker.start();
+
+        while (!items.finished.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        worker.stop();
+
+        if (items.done != target || items.sink == 0)
+        {
+            std::printf("unexpected item count\n");
+        }
+
+        return items.ns_per_item();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto items = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 20000000));
+    const auto batch = static_cast<uint64_t>(std::max(1LL, vms::bench::arg_or(argc, argv, 2, 64)));
+
+    std::printf("%llu items, batch %llu, ns per item\n", static_cast<unsigned long long>(items),
+                static_cast<unsigned long long>(batch));
+    std::printf("%-28s %10.2f\n", "Thread (virtual, 1/iter)", measure<VirtualWorker>(items));
+    std::printf("%-28s %10.2f\n", "BatchedThread (virtual)", measure<BatchedWorker>(items, batch));
+    std::printf("%-28s %10.2f\n", "StaticThread (1/iter)", measure<StaticWorker>(items, uint64_t{1}));
+    std::printf("%-28s %10.2f\n", "StaticThread (batch)", measure<StaticWorker>(items, batch));
+
+    return 0;
+}
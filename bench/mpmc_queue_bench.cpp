@@ -0,0 +1,163 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-mpmc-queue-bench [items] [max_threads_per_side]
+
+#include "bench_common.h"
+
+#include <vms/core/mpmc_queue.h>
+
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    constexpr size_t queue_capacity = 4096;
+
+    /** @brief Bounded mutex + deque queue, the baseline being replaced. */
+    class MutexQueue
+    {
+    public:
+        explicit MutexQueue(size_t capacity)
+            : capacity_(capacity)
+        {
+        }
+
+        bool try_push(uint64_t value)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (items_.size() == capacity_)
+            {
+                return false;
+            }
+
+            items_.push_back(value);
+            return true;
+        }
+
+        bool try_pop(uint64_t& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (items_.empty())
+            {
+                return false;
+            }
+
+            value = items_.front();
+            items_.pop_front();
+            return true;
+        }
+
+    private:
+        const size_t capacity_;
+        std::mutex mutex_;
+        std::deque<uint64_t> items_;
+    };
+
+    template <typename Queue>
+    double run_scaling(uint64_t items, int threads_per_side)
+    {
+        Queue queue(queue_capacity);
+        const uint64_t per_producer = items / static_cast<uint64_t>(threads_per_side);
+        const uint64_t total = per_producer * static_cast<uint64_t>(threads_per_side);
+
+        std::atomic<uint64_t> consumed{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < threads_per_side; ++p)
+        {
+            threads.emplace_back([&]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    vms::bench::wait_hint();
+                }
+
+                for (uint64_t i = 0; i < per_producer;)
+                {
+                    if (queue.try_push(i))
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        vms::bench::wait_hint();
+                    }
+                }
+            });
+        }
+
+        for (int c = 0; c < threads_per_side; ++c)
+        {
+            threads.emplace_back([&]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    vms::bench::wait_hint();
+                }
+
+                uint64_t value = 0;
+                while (consumed.load(std::memory_order_relaxed) < total)
+                {
+                    if (queue.try_pop(value))
+                    {
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        vms::bench::wait_hint();
+                    }
+                }
+            });
+        }
+
+        const auto begin = Clock::now();
+        go.store(true, std::memory_order_release);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const double seconds = vms::bench::elapsed_ns(begin, Clock::now()) / 1e9;
+        return static_cast<double>(total) / seconds;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto items = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 4000000));
+    const auto hw_threads = static_cast<long long>(std::max(1u, std::thread::hardware_concurrency()));
+    const int max_threads = static_cast<int>(vms::bench::arg_or(argc, argv, 2, std::max(1LL, hw_threads / 2)));
+
+    std::printf("%llu items, capacity %zu\n", static_cast<unsigned long long>(items), queue_capacity);
+    std::printf("%-12s %16s %16s\n", "producers/consumers", "MpmcQueue Mops/s", "mutex Mops/s");
+
+    // Powers of two, then max_threads itself when it is not one.
+    std::vector<int> steps;
+    for (int n = 1; n < max_threads; n *= 2)
+    {
+        steps.push_back(n);
+    }
+    steps.push_back(max_threads);
+
+    for (const int n : steps)
+    {
+        const double lock_free = run_scaling<vms::core::MpmcQueue<uint64_t>>(items, n);
+        const double locked = run_scaling<MutexQueue>(items, n);
+
+        std::printf("%8d/%-10d %16.2f %16.2f\n", n, n, lock_free / 1e6, locked / 1e6);
+    }
+
+    return 0;
+}
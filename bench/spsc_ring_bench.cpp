@@ -0,0 +1,169 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-spsc-ring-bench [items] [producer_cpu] [consumer_cpu]
+
+#include "bench_common.h"
+
+#include <vms/core/spsc_ring.h>
+
+#include <array>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    constexpr size_t ring_capacity = 4096;
+    constexpr size_t batch_size = 32;
+
+    double run_throughput(uint64_t items, int producer_cpu, int consumer_cpu, bool batched)
+    {
+        vms::core::SpscRing<uint64_t> ring(ring_capacity);
+        uint64_t checksum = 0;
+
+        const auto begin = Clock::now();
+
+        std::thread consumer([&]() {
+            vms::bench::pin_current_thread(consumer_cpu);
+            std::array<uint64_t, batch_size> batch{};
+
+            for (uint64_t received = 0; received < items;)
+            {
+                size_t popped = 0;
+
+                if (batched)
+                {
+                    popped = ring.try_pop_n(batch);
+                }
+                else
+                {
+                    popped = ring.try_pop(batch[0]) ? 1 : 0;
+                }
+
+                if (popped == 0)
+                {
+                    vms::bench::wait_hint();
+                    continue;
+                }
+
+                for (size_t i = 0; i < popped; ++i)
+                {
+                    checksum += batch[i];
+                }
+
+                received += popped;
+            }
+        });
+
+        vms::bench::pin_current_thread(producer_cpu);
+        std::array<uint64_t, batch_size> batch{};
+
+        for (uint64_t sent = 0; sent < items;)
+        {
+            size_t pushed = 0;
+
+            if (batched)
+            {
+                const size_t count = static_cast<size_t>(std::min<uint64_t>(batch_size, items - sent));
+                for (size_t i = 0; i < count; ++i)
+                {
+                    batch[i] = sent + i;
+                }
+
+                pushed = ring.try_push_n(std::span<const uint64_t>(batch.data(), count));
+            }
+            else
+            {
+                pushed = ring.try_push(sent) ? 1 : 0;
+            }
+
+            if (pushed == 0)
+            {
+                vms::bench::wait_hint();
+            }
+
+            sent += pushed;
+        }
+
+        consumer.join();
+        const double seconds = vms::bench::elapsed_ns(begin, Clock::now()) / 1e9;
+
+        if (checksum != items * (items - 1) / 2)
+        {
+            std::fprintf(stderr, "checksum mismatch\n");
+        }
+
+        return static_cast<double>(items) / seconds;
+    }
+
+    void run_round_trip(uint64_t round_trips, int producer_cpu, int consumer_cpu)
+    {
+        vms::core::SpscRing<uint64_t> ping(ring_capacity);
+        vms::core::SpscRing<uint64_t> pong(ring_capacity);
+
+        std::thread echo([&]() {
+            vms::bench::pin_current_thread(consumer_cpu);
+
+            for (uint64_t i = 0; i < round_trips; ++i)
+            {
+                uint64_t value = 0;
+                while (!ping.try_pop(value))
+                {
+                    vms::bench::wait_hint();
+                }
+
+                while (!pong.try_push(value))
+                {
+                    vms::bench::wait_hint();
+                }
+            }
+        });
+
+        vms::bench::pin_current_thread(producer_cpu);
+        std::vector<uint64_t> samples;
+        samples.reserve(round_trips);
+
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            const auto begin = Clock::now();
+            ping.try_push(i);
+
+            uint64_t value = 0;
+            while (!pong.try_pop(value))
+            {
+                vms::bench::wait_hint();
+            }
+
+            samples.push_back(static_cast<uint64_t>(vms::bench::elapsed_ns(begin, Clock::now())));
+        }
+
+        echo.join();
+
+        std::printf("round trip       p50 %8llu ns  p99 %8llu ns  p99.9 %8llu ns\n",
+                    static_cast<unsigned long long>(vms::bench::percentile(samples, 0.5)),
+                    static_cast<unsigned long long>(vms::bench::percentile(samples, 0.99)),
+                    static_cast<unsigned long long>(vms::bench::percentile(samples, 0.999)));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto items = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 10000000));
+    const int producer_cpu = static_cast<int>(vms::bench::arg_or(argc, argv, 2, 0));
+    const int consumer_cpu = static_cast<int>(vms::bench::arg_or(argc, argv, 3, 1));
+
+    std::printf("SpscRing<uint64_t> capacity %zu, %llu items, producer cpu %d, consumer cpu %d\n",
+                ring_capacity, static_cast<unsigned long long>(items), producer_cpu, consumer_cpu);
+
+    std::printf("single push/pop  %8.2f Mops/s\n", run_throughput(items, producer_cpu, consumer_cpu, false) / 1e6);
+    std::printf("batch of %-3zu     %8.2f Mops/s\n", batch_size, run_throughput(items, producer_cpu, consumer_cpu, true) / 1e6);
+
+    run_round_trip(std::min<uint64_t>(items / 100, 100000), producer_cpu, consumer_cpu);
+
+    return 0;
+}
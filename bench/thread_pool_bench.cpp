@@ -0,0 +1,190 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-thread-pool-bench [tasks] [workers] [tree_depth]
+
+#include "bench_common.h"
+
+#include <vms/core/thread_pool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using vms::bench::Clock;
+
+    /** @brief Single locked queue + condition variable pool, the baseline being replaced. */
+    class MutexPool
+    {
+    public:
+        explicit MutexPool(size_t workers)
+        {
+            for (size_t i = 0; i < workers; ++i)
+            {
+                threads_.emplace_back([this] { work(); });
+            }
+        }
+
+        ~MutexPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+
+            cv_.notify_all();
+
+            for (auto& thread : threads_)
+            {
+                thread.join();
+            }
+        }
+
+        void submit(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+
+            cv_.notify_one();
+        }
+
+    private:
+        void work()
+        {
+            for (;;)
+            {
+                std::function<void()> task;
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+
+                    if (tasks_.empty())
+                    {
+                        return;
+                    }
+
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+
+                task();
+            }
+        }
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<std::function<void()>> tasks_;
+        bool stopping_ = false;
+        std::vector<std::thread> threads_;
+    };
+
+    /** @brief Adapter giving ThreadPool the fire-and-forget interface of MutexPool. */
+    class StealingPool
+    {
+    public:
+        explicit StealingPool(size_t workers)
+            : pool_(workers)
+        {
+            pool_.start();
+        }
+
+        template <typename F>
+        void submit(F&& task)
+        {
+            pool_.submit(std::forward<F>(task));
+        }
+
+    private:
+        vms::core::ThreadPool pool_;
+    };
+
+    void wait_count(const std::atomic<uint64_t>& counter, uint64_t target)
+    {
+        while (counter.load(std::memory_order_acquire) < target)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /** @brief Tasks per second for @p tasks tiny tasks submitted from the main thread. */
+    template <typename Pool>
+    double run_external(uint64_t tasks, size_t workers)
+    {
+        Pool pool(workers);
+        std::atomic<uint64_t> done{0};
+
+        const auto begin = Clock::now();
+
+        for (uint64_t i = 0; i < tasks; ++i)
+        {
+            pool.submit([&done] { done.fetch_add(1, std::memory_order_release); });
+        }
+
+        wait_count(done, tasks);
+        return static_cast<double>(tasks) / (vms::bench::elapsed_ns(begin, Clock::now()) / 1e9);
+    }
+
+    template <typename Pool>
+    void spawn_tree(Pool& pool, std::atomic<uint64_t>& leaves, int depth)
+    {
+        if (depth == 0)
+        {
+            leaves.fetch_add(1, std::memory_order_release);
+            return;
+        }
+
+        pool.submit([&pool, &leaves, depth] { spawn_tree(pool, leaves, depth - 1); });
+        pool.submit([&pool, &leaves, depth] { spawn_tree(pool, leaves, depth - 1); });
+    }
+
+    /** @brief Tasks per second for a binary tree of tasks spawned from inside the pool. */
+    template <typename Pool>
+    double run_fan_out(int depth, size_t workers)
+    {
+        Pool pool(workers);
+        std::atomic<uint64_t> leaves{0};
+        const uint64_t leaf_count = uint64_t{1} << depth;
+
+        const auto begin = Clock::now();
+        pool.submit([&pool, &leaves, depth] { spawn_tree(pool, leaves, depth); });
+
+        wait_count(leaves, leaf_count);
+
+        const uint64_t tasks = 2 * leaf_count - 1;
+        return static_cast<double>(tasks) / (vms::bench::elapsed_ns(begin, Clock::now()) / 1e9);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto tasks = static_cast<uint64_t>(vms::bench::arg_or(argc, argv, 1, 1000000));
+    const auto hw_threads = static_cast<long long>(std::max(1u, std::thread::hardware_concurrency()));
+    const auto workers = static_cast<size_t>(vms::bench::arg_or(argc, argv, 2, hw_threads));
+    const int depth = static_cast<int>(vms::bench::arg_or(argc, argv, 3, 18));
+
+    std::printf("%zu workers\n", workers);
+    std::printf("%-24s %16s %16s\n", "scenario", "stealing Mtask/s", "mutex Mtask/s");
+
+    std::printf("%-24s %16.2f %16.2f\n", "external submit",
+                run_external<StealingPool>(tasks, workers) / 1e6,
+                run_external<MutexPool>(tasks, workers) / 1e6);
+
+    std::printf("%-24s %16.2f %16.2f\n", "fan-out from tasks",
+                run_fan_out<StealingPool>(depth, workers) / 1e6,
+                run_fan_out<MutexPool>(depth, workers) / 1e6);
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-timer-service-bench [timers] [tick_us] [seconds]
+//
+// Schedule and cancel cost on a loaded wheel, then per-tick cost of the
+// worker while the given number of periodic timers are active.
+
+#include "bench_common.h"
+
+#include <vms/core/timer_service.h>
+
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    using vms::bench::Clock;
+    using vms::core::TimerService;
+
+    const auto timers = static_cast<size_t>(vms::bench::arg_or(argc, argv, 1, 100000));
+    const auto tick_us = static_cast<int32_t>(vms::bench::arg_or(argc, argv, 2, 1000));
+    const auto seconds = vms::bench::arg_or(argc, argv, 3, 3);
+
+    TimerService service(tick_us, timers);
+    std::atomic<uint64_t> fired{0};
+    std::vector<TimerService::TimerId> ids(timers);
+
+    // Periods spread over 10..1000 ticks, so every tick expires a handful of timers.
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> period_ticks(10, 1000);
+    std::vector<std::chrono::microseconds> periods(timers);
+
+    for (auto& period : periods)
+    {
+        period = std::chrono::microseconds(int64_t{tick_us} * period_ticks(rng));
+    }
+
+    auto begin = Clock::now();
+
+    for (size_t i = 0; i < timers; ++i)
+    {
+        ids[i] = service.schedule_every(periods[i], [&fired] { fired.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    const double schedule_ns = vms::bench::elapsed_ns(begin, Clock::now()) / static_cast<double>(timers);
+
+    begin = Clock::now();
+
+    for (size_t i = 0; i < timers; ++i)
+    {
+        service.cancel(ids[i]);
+    }
+
+    const double cancel_ns = vms::bench::elapsed_ns(begin, Clock::now()) / static_cast<double>(timers);
+
+    for (size_t i = 0; i < timers; ++i)
+    {
+        ids[i] = service.schedule_every(periods[i], [&fired] { fired.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    service.enable_statistics();
+    service.start();
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    service.stop();
+
+    const auto stats = service.statistics();
+
+    std::printf("%zu timers, tick %dus\n", timers, tick_us);
+    std::printf("schedule %10.1f ns/op\n", schedule_ns);
+    std::printf("cancel   %10.1f ns/op\n", cancel_ns);
+    std::printf("callbacks fired      %12llu\n", static_cast<unsigned long long>(fired.load()));
+    std::printf("ticks run            %12llu\n", static_cast<unsigned long long>(stats.run_duration.count));
+    std::printf("per-tick cost  mean %10.1f us  max %10.1f us\n", stats.run_duration.mean() / 1e3,
+                static_cast<double>(stats.run_duration.max) / 1e3);
+    std::printf("wake-up error  p50  %10.1f us  p99 %10.1f us\n",
+                static_cast<double>(stats.wakeup_percentile(0.5)) / 1e3,
+                static_cast<double>(stats.wakeup_percentile(0.99)) / 1e3);
+
+    return 0;
+}
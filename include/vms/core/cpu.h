@@ -0,0 +1,41 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace vms::core
+{
+    /**
+     * @brief Granularity used to keep independently written data apart.
+     *
+     * Fixed rather than std::hardware_destructive_interference_size, whose
+     * value may change across compiler flags and break the ABI.
+     */
+    inline constexpr std::size_t cache_line_size = 64;
+
+    /**
+     * @brief Tell the CPU the caller is busy-waiting.
+     *
+     * Emits PAUSE on x86 and YIELD on ARM: it lowers the power drawn by the
+     * spin and frees pipeline resources for the sibling hyper-thread.
+     */
+    inline void cpu_relax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#else
+        asm volatile("" ::: "memory");
+#endif
+    }
+}
@@ -0,0 +1,133 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace vms::core
+{
+    class Thread;
+
+    /** @brief What happens to a set Event once a waiter has seen it. */
+    enum class EventMode : int
+    {
+        /** Stays set, releasing every waiter, until reset(). */
+        MANUAL_RESET,
+        /** Released waiter clears it: each set() lets exactly one wait() through. */
+        AUTO_RESET
+    };
+
+    /**
+     * @brief Futex-backed event, a lighter replacement for a mutex + condition_variable pair.
+     *
+     * set() costs one atomic RMW and a load when nobody is waiting; the
+     * FUTEX_WAKE syscall is only issued when a waiter is registered.
+     * wait() never takes a lock. Inside Thread::run() prefer
+     * Thread::wait_event(), which is also woken by wake() and stop().
+     */
+    class Event
+    {
+    public:
+        explicit Event(EventMode mode = EventMode::MANUAL_RESET, bool initially_set = false);
+
+        Event(const Event&) = delete;
+        Event& operator=(const Event&) = delete;
+
+        /** @brief Signal the event, waking every waiter (MANUAL_RESET) or one of them (AUTO_RESET). */
+        void set ();
+
+        /** @brief Clear the event; a no-op when not set. */
+        void reset ();
+
+        /** @brief Whether the event is currently set. */
+        bool is_set () const;
+
+        /** @brief Selected reset mode. */
+        EventMode mode () const;
+
+        /** @brief Block until the event is set (and consume it in AUTO_RESET mode). */
+        void wait ();
+
+        /**
+         * @brief Block until the event is set or @p deadline elapses.
+         *
+         * @return true the event was set (and consumed in AUTO_RESET mode)
+         * @return false the deadline elapsed
+         */
+        bool wait_until (std::chrono::steady_clock::time_point deadline);
+
+        /** @brief Block for at most @p timeout, see wait_until(). */
+        bool wait_for (std::chrono::steady_clock::duration timeout);
+
+        /** @brief Consume the event without blocking (AUTO_RESET), or test it (MANUAL_RESET). */
+        bool try_wait ();
+
+    private:
+        friend class Thread;
+
+        /**
+         * @brief Wait loop shared by every overload.
+         *
+         * Gives up, returning false, as soon as @p cancel has any of
+         * @p cancel_mask set; interrupt() must follow the cancellation for
+         * a blocked waiter to notice it.
+         */
+        bool wait_cancellable (std::chrono::steady_clock::time_point deadline,
+                               const std::atomic<uint32_t>* cancel, uint32_t cancel_mask);
+
+        /**
+         * @brief Kick every blocked waiter so that it re-checks its cancellation.
+         *
+         * Bumps the generation in the futex word, so a waiter about to
+         * block cannot miss it. The event state is left untouched.
+         */
+        void interrupt ();
+
+        /** @brief SIGNALED bit plus an interrupt generation in the upper bits (futex word). */
+        std::atomic<uint32_t> word_;
+
+        /** @brief Number of threads inside wait(), lets set() skip the syscall. */
+        std::atomic<uint32_t> waiters_;
+
+        const EventMode mode_;
+    };
+
+    /**
+     * @brief Binary semaphore on the same futex word as an AUTO_RESET Event.
+     *
+     * release() makes one token available (releasing twice without an
+     * acquire still leaves one); acquire() takes it, blocking until there
+     * is one. Inside Thread::run() prefer Thread::wait_acquire().
+     */
+    class BinarySemaphore
+    {
+    public:
+        explicit BinarySemaphore(bool available = false);
+
+        /** @brief Make the token available, waking one waiter if any. */
+        void release ();
+
+        /** @brief Take the token, blocking until it is available. */
+        void acquire ();
+
+        /** @brief Take the token without blocking; false when unavailable. */
+        bool try_acquire ();
+
+        /** @brief Take the token, giving up at @p deadline; false on timeout. */
+        bool try_acquire_until (std::chrono::steady_clock::time_point deadline);
+
+        /** @brief Take the token, giving up after @p timeout; false on timeout. */
+        bool try_acquire_for (std::chrono::steady_clock::duration timeout);
+
+    private:
+        friend class Thread;
+
+        Event event_;
+    };
+}
@@ -0,0 +1,44 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace vms::core
+{
+    /**
+     * @brief Block while @p word still holds @p expected.
+     *
+     * Thin wrapper over FUTEX_WAIT (process private). Spurious returns are
+     * possible, callers must re-check their condition.
+     */
+    void futex_wait (std::atomic<uint32_t>& word, uint32_t expected);
+
+    /**
+     * @brief Block while @p word holds @p expected, at most until @p deadline.
+     *
+     * The deadline is absolute on CLOCK_MONOTONIC (the clock behind
+     * @c std::chrono::steady_clock), so repeated waits do not accumulate drift.
+     *
+     * @return true returned before the deadline (woken, value changed or spurious)
+     * @return false the deadline elapsed
+     */
+    bool futex_wait_until (std::atomic<uint32_t>& word, uint32_t expected,
+                           std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Wake up to @p count waiters blocked on @p word.
+     *
+     * @return number of waiters woken
+     */
+    int futex_wake (std::atomic<uint32_t>& word, int count = 1);
+
+    /** @brief Wake every waiter blocked on @p word. */
+    int futex_wake_all (std::atomic<uint32_t>& word);
+}
@@ -0,0 +1,168 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    template <typename Signature, std::size_t Capacity = cache_line_size - sizeof(void*)>
+    class InplaceFunction;
+
+    /**
+     * @brief Move-only callable stored entirely inline.
+     *
+     * A replacement for std::function on hot submission paths: the callable
+     * lives in a fixed buffer of @p Capacity bytes and is never allocated on
+     * the heap. A callable that does not fit, is over-aligned or may throw
+     * on move is rejected at compile time, so moving an InplaceFunction in
+     * and out of a queue never allocates and never throws.
+     *
+     * @tparam R result type
+     * @tparam Args argument types
+     * @tparam Capacity inline storage in bytes, by default sized so that the
+     *         whole object spans one cache line
+     */
+    template <typename R, typename... Args, std::size_t Capacity>
+    class InplaceFunction<R(Args...), Capacity>
+    {
+    public:
+        static constexpr std::size_t capacity = Capacity;
+
+        InplaceFunction() noexcept = default;
+
+        InplaceFunction(std::nullptr_t) noexcept
+        {
+        }
+
+        /** @brief Store @p fn inline; fails to compile when it does not fit. */
+        template <typename F, typename Fn = std::decay_t<F>,
+                  typename = std::enable_if_t<!std::is_same_v<Fn, InplaceFunction> &&
+                                              std::is_invocable_r_v<R, Fn&, Args...>>>
+        InplaceFunction(F&& fn) noexcept(std::is_nothrow_constructible_v<Fn, F>)
+        {
+            static_assert(sizeof(Fn) <= Capacity,
+                          "callable does not fit in InplaceFunction, increase Capacity or shrink the capture");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                          "over-aligned callables are not supported by InplaceFunction");
+            static_assert(std::is_nothrow_move_constructible_v<Fn>,
+                          "InplaceFunction requires a callable with a noexcept move constructor");
+
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(fn));
+            ops_ = &ops_for<Fn>;
+        }
+
+        InplaceFunction(InplaceFunction&& other) noexcept
+            : ops_(other.ops_)
+        {
+            if (ops_ != nullptr)
+            {
+                ops_->relocate(storage_, other.storage_);
+                other.ops_ = nullptr;
+            }
+        }
+
+        InplaceFunction& operator=(InplaceFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+
+                if (other.ops_ != nullptr)
+                {
+                    other.ops_->relocate(storage_, other.storage_);
+                    ops_ = std::exchange(other.ops_, nullptr);
+                }
+            }
+
+            return *this;
+        }
+
+        InplaceFunction& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        InplaceFunction(const InplaceFunction&) = delete;
+        InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+        ~InplaceFunction()
+        {
+            reset();
+        }
+
+        /** @brief Whether a callable is stored. */
+        explicit operator bool () const noexcept
+        {
+            return ops_ != nullptr;
+        }
+
+        /** @brief Invoke the stored callable; undefined when empty. */
+        R operator() (Args... args)
+        {
+            return ops_->invoke(storage_, std::forward<Args>(args)...);
+        }
+
+        /** @brief Destroy the stored callable, leaving the function empty. */
+        void reset () noexcept
+        {
+            if (ops_ != nullptr)
+            {
+                ops_->destroy(storage_);
+                ops_ = nullptr;
+            }
+        }
+
+    private:
+        /** @brief Per-callable type operations, one static table per type. */
+        struct Ops
+        {
+            R (*invoke)(void* storage, Args&&... args);
+
+            /** @brief Move-construct into @p dst and destroy @p src. */
+            void (*relocate)(void* dst, void* src) noexcept;
+
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename Fn>
+        static constexpr Ops ops_for = {
+            [](void* storage, Args&&... args) -> R {
+                if constexpr (std::is_void_v<R>)
+                {
+                    // Any result of the callable is discarded.
+                    std::invoke(*std::launder(static_cast<Fn*>(storage)), std::forward<Args>(args)...);
+                }
+                else
+                {
+                    return std::invoke(*std::launder(static_cast<Fn*>(storage)), std::forward<Args>(args)...);
+                }
+            },
+            [](void* dst, void* src) noexcept {
+                Fn* from = std::launder(static_cast<Fn*>(src));
+                ::new (dst) Fn(std::move(*from));
+                from->~Fn();
+            },
+            [](void* storage) noexcept {
+                std::launder(static_cast<Fn*>(storage))->~Fn();
+            },
+        };
+
+        alignas(std::max_align_t) unsigned char storage_[Capacity];
+        const Ops* ops_ = nullptr;
+    };
+
+    /** @brief Default task type for queues and workers. */
+    using InplaceTask = InplaceFunction<void()>;
+}
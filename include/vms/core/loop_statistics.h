@@ -0,0 +1,201 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace vms::core
+{
+    /**
+     * @brief Log-linear (HDR style) bucketing of non-negative integer samples.
+     *
+     * Values below 16 get a bucket each, above that every power of two is
+     * split into 16 linear sub-buckets, bounding the relative error to ~6%
+     * over the full 64-bit range with a fixed number of buckets.
+     */
+    struct LogLinearBuckets
+    {
+        static constexpr unsigned SUB_BUCKET_BITS = 4;
+        static constexpr uint64_t SUB_BUCKET_COUNT = uint64_t{1} << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        /** @brief Bucket holding @p value. */
+        static constexpr size_t index (uint64_t value) noexcept
+        {
+            if (value < SUB_BUCKET_COUNT)
+            {
+                return static_cast<size_t>(value);
+            }
+
+            const unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(value));
+            const uint64_t sub = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+
+            return static_cast<size_t>((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub);
+        }
+
+        /** @brief Smallest value falling in bucket @p idx. */
+        static constexpr uint64_t lower_bound (size_t idx) noexcept
+        {
+            if (idx < SUB_BUCKET_COUNT)
+            {
+                return idx;
+            }
+
+            const unsigned exponent = static_cast<unsigned>(idx / SUB_BUCKET_COUNT) + SUB_BUCKET_BITS - 1;
+            const uint64_t sub = idx % SUB_BUCKET_COUNT;
+
+            return (SUB_BUCKET_COUNT + sub) << (exponent - SUB_BUCKET_BITS);
+        }
+
+        /** @brief Largest value falling in bucket @p idx. */
+        static constexpr uint64_t upper_bound (size_t idx) noexcept
+        {
+            if (idx < SUB_BUCKET_COUNT)
+            {
+                return idx;
+            }
+
+            const unsigned exponent = static_cast<unsigned>(idx / SUB_BUCKET_COUNT) + SUB_BUCKET_BITS - 1;
+            return lower_bound(idx) + ((uint64_t{1} << (exponent - SUB_BUCKET_BITS)) - 1);
+        }
+    };
+
+    /**
+     * @brief Plain copy of a LoopStatistics, safe to inspect at leisure.
+     *
+     * All durations are expressed in nanoseconds.
+     */
+    struct LoopStatisticsSnapshot
+    {
+        struct Summary
+        {
+            uint64_t count = 0;
+            uint64_t min = 0;
+            uint64_t max = 0;
+            uint64_t total = 0;
+
+            /** @brief Arithmetic mean, 0 when empty. */
+            double mean () const noexcept;
+        };
+
+        /** @brief Delay between the scheduled slot and the actual start of run(). */
+        Summary wakeup_latency;
+        /** @brief Time spent inside run(). */
+        Summary run_duration;
+        /** @brief Start-to-start distance between consecutive iterations. */
+        Summary period;
+        /** @brief Wake-up latency distribution, see LogLinearBuckets. */
+        std::array<uint64_t, LogLinearBuckets::BUCKET_COUNT> wakeup_histogram{};
+
+        /**
+         * @brief Wake-up latency below which the @p quantile fraction of samples fall.
+         *
+         * Reported as the upper bound of the matching bucket (never under-estimates).
+         *
+         * @param quantile value in [0, 1], e.g. 0.9999
+         */
+        uint64_t wakeup_percentile (double quantile) const noexcept;
+    };
+
+    /**
+     * @brief Lock-free timing statistics of a periodic loop.
+     *
+     * Samples are recorded by a single writer (the loop) with relaxed
+     * load/store pairs: no locked instruction, no allocation. Any number of
+     * readers may call snapshot() concurrently; a snapshot taken while the
+     * writer is active can be off by the sample in flight.
+     */
+    class LoopStatistics
+    {
+    public:
+        LoopStatistics() = default;
+
+        LoopStatistics(const LoopStatistics&) = delete;
+        LoopStatistics& operator=(const LoopStatistics&) = delete;
+
+        /** @brief Writer side: account the start of an iteration. */
+        void record_wakeup (uint64_t latency_ns, uint64_t period_ns) noexcept
+        {
+            apply_pending_reset();
+
+            wakeup_latency_.record(latency_ns);
+            if (period_ns != 0)
+            {
+                period_.record(period_ns);
+            }
+
+            auto& bucket = wakeup_histogram_[LogLinearBuckets::index(latency_ns)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        /** @brief Writer side: account the duration of run(). */
+        void record_run (uint64_t duration_ns) noexcept
+        {
+            run_duration_.record(duration_ns);
+        }
+
+        /**
+         * @brief Ask the writer to clear the statistics before its next sample.
+         *
+         * Callable from any thread; keeps the single-writer guarantee.
+         */
+        void request_reset () noexcept
+        {
+            reset_requested_.store(true, std::memory_order_relaxed);
+        }
+
+        /** @brief Reader side: copy the current values. */
+        LoopStatisticsSnapshot snapshot () const noexcept;
+
+    private:
+        struct Summary
+        {
+            std::atomic<uint64_t> count{0};
+            std::atomic<uint64_t> min{UINT64_MAX};
+            std::atomic<uint64_t> max{0};
+            std::atomic<uint64_t> total{0};
+
+            void record (uint64_t value) noexcept
+            {
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                total.store(total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+
+                if (value < min.load(std::memory_order_relaxed))
+                {
+                    min.store(value, std::memory_order_relaxed);
+                }
+
+                if (value > max.load(std::memory_order_relaxed))
+                {
+                    max.store(value, std::memory_order_relaxed);
+                }
+            }
+
+            void clear () noexcept;
+            LoopStatisticsSnapshot::Summary load () const noexcept;
+        };
+
+        void apply_pending_reset () noexcept
+        {
+            if (reset_requested_.load(std::memory_order_relaxed))
+            {
+                clear();
+            }
+        }
+
+        void clear () noexcept;
+
+        Summary wakeup_latency_;
+        Summary run_duration_;
+        Summary period_;
+        std::array<std::atomic<uint64_t>, LogLinearBuckets::BUCKET_COUNT> wakeup_histogram_{};
+        std::atomic<bool> reset_requested_{false};
+    };
+}
@@ -0,0 +1,290 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Bounded lock-free multi-producer/multi-consumer queue.
+     *
+     * Sequence-per-slot design: every slot carries a sequence number telling
+     * whether it is free for the producer of position @c pos (seq == pos) or
+     * filled for the consumer of that position (seq == pos + 1). Producers
+     * and consumers only contend on their own position counter, each on its
+     * own cache line, and slots are cache-line aligned so neighbouring
+     * elements never share a line.
+     *
+     * @tparam T element type, must be nothrow move constructible
+     */
+    template <typename T>
+    class MpmcQueue
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+                      "MpmcQueue elements must be nothrow move constructible");
+
+    public:
+        /**
+         * @brief Allocate the queue.
+         *
+         * @param capacity minimum number of elements, rounded up to a power of two (at least 2)
+         */
+        explicit MpmcQueue(std::size_t capacity)
+            : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+            , mask_(capacity_ - 1)
+            , slots_(std::make_unique<Slot[]>(capacity_))
+        {
+            for (std::size_t idx = 0; idx < capacity_; ++idx)
+            {
+                slots_[idx].sequence.store(idx, std::memory_order_relaxed);
+            }
+        }
+
+        ~MpmcQueue()
+        {
+            const std::size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+
+            for (std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != tail; ++pos)
+            {
+                std::destroy_at(slots_[pos & mask_].element());
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        /** @brief Construct an element in place; false when full. */
+        template <typename... Args>
+        bool try_emplace (Args&&... args)
+        {
+            std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+
+            for (;;)
+            {
+                slot = &slots_[pos & mask_];
+                const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            std::construct_at(slot->element(), std::forward<Args>(args)...);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Copy @p value in; false when full. */
+        bool try_push (const T& value)
+        {
+            return try_emplace(value);
+        }
+
+        /** @brief Move @p value in; false when full. */
+        bool try_push (T&& value)
+        {
+            return try_emplace(std::move(value));
+        }
+
+        /** @brief Move the oldest element into @p out; false when empty. */
+        bool try_pop (T& out)
+        {
+            std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+
+            for (;;)
+            {
+                slot = &slots_[pos & mask_];
+                const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            release_slot(*slot, pos, out);
+            return true;
+        }
+
+        /**
+         * @brief Copy a prefix of @p items in, claiming the slots with a single CAS.
+         *
+         * @return number of elements pushed
+         */
+        std::size_t try_push_n (std::span<const T> items)
+        {
+            std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+
+            for (;;)
+            {
+                count = ready_run(pos, 0, items.size());
+
+                if (count == 0)
+                {
+                    // Either full or another producer moved on: only retry the latter.
+                    const std::size_t current = enqueue_pos_.load(std::memory_order_relaxed);
+                    if (current == pos || items.empty())
+                    {
+                        return 0;
+                    }
+
+                    pos = current;
+                    continue;
+                }
+
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                Slot& slot = slots_[(pos + idx) & mask_];
+                std::construct_at(slot.element(), items[idx]);
+                slot.sequence.store(pos + idx + 1, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Move up to @p out.size() elements out, claiming them with a single CAS.
+         *
+         * @return number of elements popped
+         */
+        std::size_t try_pop_n (std::span<T> out)
+        {
+            std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+
+            for (;;)
+            {
+                count = ready_run(pos, 1, out.size());
+
+                if (count == 0)
+                {
+                    const std::size_t current = dequeue_pos_.load(std::memory_order_relaxed);
+                    if (current == pos || out.empty())
+                    {
+                        return 0;
+                    }
+
+                    pos = current;
+                    continue;
+                }
+
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                release_slot(slots_[(pos + idx) & mask_], pos + idx, out[idx]);
+            }
+
+            return count;
+        }
+
+        /** @brief Approximate number of stored elements. */
+        std::size_t size_approx () const noexcept
+        {
+            const std::size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+            const std::size_t head = dequeue_pos_.load(std::memory_order_relaxed);
+            return (tail > head) ? std::min(tail - head, capacity_) : 0;
+        }
+
+        /** @brief Number of slots (power of two). */
+        std::size_t capacity () const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        struct alignas(cache_line_size) Slot
+        {
+            std::atomic<std::size_t> sequence{0};
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T* element () noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        /** @brief Count the consecutive slots from @p pos whose sequence is pos + offset. */
+        std::size_t ready_run (std::size_t pos, std::size_t offset, std::size_t limit) const noexcept
+        {
+            const std::size_t max_count = std::min(limit, capacity_);
+            std::size_t count = 0;
+
+            while (count < max_count
+                   && slots_[(pos + count) & mask_].sequence.load(std::memory_order_acquire) == pos + count + offset)
+            {
+                ++count;
+            }
+
+            return count;
+        }
+
+        /** @brief Move the element out of @p slot and hand the slot to the producer one lap ahead. */
+        void release_slot (Slot& slot, std::size_t pos, T& out)
+        {
+            T* element = slot.element();
+            out = std::move(*element);
+            std::destroy_at(element);
+            slot.sequence.store(pos + capacity_, std::memory_order_release);
+        }
+
+        alignas(cache_line_size) std::atomic<std::size_t> enqueue_pos_{0};
+        alignas(cache_line_size) std::atomic<std::size_t> dequeue_pos_{0};
+        alignas(cache_line_size) const std::size_t capacity_;
+        const std::size_t mask_;
+        const std::unique_ptr<Slot[]> slots_;
+    };
+}
@@ -0,0 +1,258 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    namespace detail
+    {
+        /**
+         * @brief Storage of a trivially copyable value as relaxed atomic words.
+         *
+         * Readers may copy while the writer overwrites: going through
+         * atomics keeps that race defined, the sequence counter around the
+         * copy tells whether the result is usable. Relaxed word accesses
+         * compile to plain moves.
+         */
+        template <typename T>
+        class SeqlockStorage
+        {
+        public:
+            static constexpr std::size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+            void write (const T& value) noexcept
+            {
+                const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+
+                // Word by word: no stack copy of a large T on the writer side.
+                for (std::size_t idx = 0; idx < WORDS; ++idx)
+                {
+                    uint64_t word = 0;
+                    std::memcpy(&word, bytes + idx * sizeof(uint64_t), chunk(idx));
+                    words_[idx].store(word, std::memory_order_relaxed);
+                }
+            }
+
+            void read (T& out) const noexcept
+            {
+                auto* bytes = reinterpret_cast<unsigned char*>(&out);
+
+                for (std::size_t idx = 0; idx < WORDS; ++idx)
+                {
+                    const uint64_t word = words_[idx].load(std::memory_order_relaxed);
+                    std::memcpy(bytes + idx * sizeof(uint64_t), &word, chunk(idx));
+                }
+            }
+
+        private:
+            /** @brief Bytes of T held by word @p idx (the last one may be partial). */
+            static constexpr std::size_t chunk (std::size_t idx) noexcept
+            {
+                return (idx + 1 < WORDS) ? sizeof(uint64_t) : sizeof(T) - idx * sizeof(uint64_t);
+            }
+
+            std::array<std::atomic<uint64_t>, WORDS> words_{};
+        };
+
+        /** @brief Back-off of a reader that caught the writer mid-update. */
+        inline void seqlock_backoff(unsigned& attempts) noexcept
+        {
+            // The writer may be preempted mid-update: stop burning its CPU.
+            if (++attempts % 64 == 0)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                cpu_relax();
+            }
+        }
+    }
+
+    /**
+     * @brief Sequence lock publishing a value from one writer to any number of readers.
+     *
+     * store() is wait-free: two counter stores around the copy, no lock,
+     * no allocation, never delayed by readers. Readers retry when they
+     * overlap a store, so they can starve under a writer that stores
+     * back-to-back; prefer MultiSlotSeqlock when T is large or readers
+     * are slow.
+     *
+     * @tparam T published value, must be trivially copyable
+     */
+    template <typename T>
+    class Seqlock
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Seqlock values must be trivially copyable");
+
+    public:
+        /** @brief Publish @p initial as version 0. */
+        explicit Seqlock(const T& initial = T{}) noexcept
+        {
+            storage_.write(initial);
+        }
+
+        Seqlock(const Seqlock&) = delete;
+        Seqlock& operator=(const Seqlock&) = delete;
+
+        /** @brief Writer: publish @p value. Only one thread may store. */
+        void store (const T& value) noexcept
+        {
+            const uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+
+            sequence_.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            storage_.write(value);
+
+            sequence_.store(sequence + 2, std::memory_order_release);
+        }
+
+        /** @brief Reader: single attempt; false when it overlapped a store. */
+        bool try_load (T& out) const noexcept
+        {
+            const uint64_t before = sequence_.load(std::memory_order_acquire);
+
+            if ((before & 1) != 0)
+            {
+                return false;
+            }
+
+            storage_.read(out);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            return sequence_.load(std::memory_order_relaxed) == before;
+        }
+
+        /** @brief Reader: consistent copy of the last published value, retrying as needed. */
+        T load () const noexcept
+        {
+            T value;
+            unsigned attempts = 0;
+
+            while (!try_load(value))
+            {
+                detail::seqlock_backoff(attempts);
+            }
+
+            return value;
+        }
+
+        /** @brief Number of completed store() calls. */
+        uint64_t version () const noexcept
+        {
+            return sequence_.load(std::memory_order_acquire) / 2;
+        }
+
+    private:
+        alignas(cache_line_size) std::atomic<uint64_t> sequence_{0};
+        detail::SeqlockStorage<T> storage_;
+    };
+
+    /**
+     * @brief Seqlock rotating over @p Slots copies of the value.
+     *
+     * Each store() goes to the next slot and is published once complete,
+     * so readers copy the latest finished value while the writer fills
+     * another slot: a reader only retries when the writer laps all the
+     * slots during its copy. Meant for large T (whole state vectors)
+     * read by slow consumers. store() keeps the Seqlock guarantees:
+     * wait-free, no lock, no allocation.
+     *
+     * @tparam T     published value, must be trivially copyable
+     * @tparam Slots number of copies, at least 2
+     */
+    template <typename T, std::size_t Slots = 4>
+    class MultiSlotSeqlock
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "MultiSlotSeqlock values must be trivially copyable");
+        static_assert(Slots >= 2, "MultiSlotSeqlock needs at least two slots");
+
+    public:
+        /** @brief Publish @p initial as version 0. */
+        explicit MultiSlotSeqlock(const T& initial = T{}) noexcept
+        {
+            slots_[0].storage.write(initial);
+        }
+
+        MultiSlotSeqlock(const MultiSlotSeqlock&) = delete;
+        MultiSlotSeqlock& operator=(const MultiSlotSeqlock&) = delete;
+
+        /** @brief Writer: publish @p value. Only one thread may store. */
+        void store (const T& value) noexcept
+        {
+            // Slot sequence: 2 * version once complete, odd while being written.
+            const uint64_t version = latest_.load(std::memory_order_relaxed) + 1;
+            Slot& slot = slots_[version % Slots];
+
+            slot.sequence.store(2 * version + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot.storage.write(value);
+
+            slot.sequence.store(2 * version, std::memory_order_release);
+            latest_.store(version, std::memory_order_release);
+        }
+
+        /** @brief Reader: single attempt; false when the writer lapped the slot being read. */
+        bool try_load (T& out) const noexcept
+        {
+            const uint64_t version = latest_.load(std::memory_order_acquire);
+            const Slot& slot = slots_[version % Slots];
+
+            if (slot.sequence.load(std::memory_order_acquire) != 2 * version)
+            {
+                return false;
+            }
+
+            slot.storage.read(out);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            return slot.sequence.load(std::memory_order_relaxed) == 2 * version;
+        }
+
+        /** @brief Reader: consistent copy of the last published value, retrying as needed. */
+        T load () const noexcept
+        {
+            T value;
+            unsigned attempts = 0;
+
+            while (!try_load(value))
+            {
+                detail::seqlock_backoff(attempts);
+            }
+
+            return value;
+        }
+
+        /** @brief Number of completed store() calls. */
+        uint64_t version () const noexcept
+        {
+            return latest_.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct alignas(cache_line_size) Slot
+        {
+            std::atomic<uint64_t> sequence{0};
+            detail::SeqlockStorage<T> storage;
+        };
+
+        alignas(cache_line_size) std::atomic<uint64_t> latest_{0};
+        std::array<Slot, Slots> slots_{};
+    };
+}
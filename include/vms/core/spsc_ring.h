@@ -0,0 +1,219 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Bounded lock-free single-producer/single-consumer ring buffer.
+     *
+     * Exactly one thread may push and exactly one thread may pop at any
+     * time. Indices grow monotonically and are masked into a power-of-two
+     * buffer; producer and consumer indices live on separate cache lines
+     * and each side keeps a cached copy of the opposite index, so the
+     * shared line is only read when the ring looks full (or empty).
+     *
+     * @tparam T element type, must be nothrow move constructible
+     */
+    template <typename T>
+    class SpscRing
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+                      "SpscRing elements must be nothrow move constructible");
+
+    public:
+        /**
+         * @brief Allocate the ring.
+         *
+         * @param capacity minimum number of elements, rounded up to a power of two (at least 2)
+         */
+        explicit SpscRing(std::size_t capacity)
+            : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+            , mask_(capacity_ - 1)
+            , buffer_(std::allocator<T>{}.allocate(capacity_))
+        {
+        }
+
+        ~SpscRing()
+        {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+            for (std::size_t idx = head_.load(std::memory_order_relaxed); idx != tail; ++idx)
+            {
+                std::destroy_at(&buffer_[idx & mask_]);
+            }
+
+            std::allocator<T>{}.deallocate(buffer_, capacity_);
+        }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        /** @brief Producer: construct an element in place; false when full. */
+        template <typename... Args>
+        bool try_emplace (Args&&... args)
+        {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+            if (tail - cached_head_ == capacity_)
+            {
+                cached_head_ = head_.load(std::memory_order_acquire);
+
+                if (tail - cached_head_ == capacity_)
+                {
+                    return false;
+                }
+            }
+
+            std::construct_at(&buffer_[tail & mask_], std::forward<Args>(args)...);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Producer: copy @p value in; false when full. */
+        bool try_push (const T& value)
+        {
+            return try_emplace(value);
+        }
+
+        /** @brief Producer: move @p value in; false when full. */
+        bool try_push (T&& value)
+        {
+            return try_emplace(std::move(value));
+        }
+
+        /**
+         * @brief Producer: copy as many of @p items as fit, publishing them at once.
+         *
+         * @return number of elements pushed (a prefix of @p items)
+         */
+        std::size_t try_push_n (std::span<const T> items)
+        {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+            std::size_t free_slots = capacity_ - (tail - cached_head_);
+
+            if (free_slots < items.size())
+            {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                free_slots = capacity_ - (tail - cached_head_);
+            }
+
+            const std::size_t count = std::min(free_slots, items.size());
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                std::construct_at(&buffer_[(tail + idx) & mask_], items[idx]);
+            }
+
+            if (count != 0)
+            {
+                tail_.store(tail + count, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        /** @brief Consumer: move the oldest element into @p out; false when empty. */
+        bool try_pop (T& out)
+        {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+
+            if (head == cached_tail_)
+            {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+
+                if (head == cached_tail_)
+                {
+                    return false;
+                }
+            }
+
+            T& slot = buffer_[head & mask_];
+            out = std::move(slot);
+            std::destroy_at(&slot);
+
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer: move up to @p out.size() elements out, releasing them at once.
+         *
+         * @return number of elements popped
+         */
+        std::size_t try_pop_n (std::span<T> out)
+        {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            std::size_t available = cached_tail_ - head;
+
+            if (available < out.size())
+            {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                available = cached_tail_ - head;
+            }
+
+            const std::size_t count = std::min(available, out.size());
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                T& slot = buffer_[(head + idx) & mask_];
+                out[idx] = std::move(slot);
+                std::destroy_at(&slot);
+            }
+
+            if (count != 0)
+            {
+                head_.store(head + count, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        /** @brief Number of stored elements; exact only when called by either side. */
+        std::size_t size () const noexcept
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+
+        /** @brief Whether the ring looks empty. */
+        bool empty () const noexcept
+        {
+            return size() == 0;
+        }
+
+        /** @brief Number of slots (power of two). */
+        std::size_t capacity () const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        /** @brief Consumer line: next slot to read and cached producer index. */
+        alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+        std::size_t cached_tail_ = 0;
+
+        /** @brief Producer line: next slot to write and cached consumer index. */
+        alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+        std::size_t cached_head_ = 0;
+
+        /** @brief Read-only after construction, shared by both sides. */
+        alignas(cache_line_size) const std::size_t capacity_;
+        const std::size_t mask_;
+        T* const buffer_;
+    };
+}
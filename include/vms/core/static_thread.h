@@ -0,0 +1,395 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <vms/core/thread_base.h>
+#include <vms/core/thread_core.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Gateway StaticThread uses to reach the hooks of a derived class.
+     *
+     * Hooks may be public; when they are protected or private the derived
+     * class grants access with @c friend @c struct @c vms::core::StaticThreadAccess.
+     * The forwarders are SFINAE-friendly, so a missing hook simply makes the
+     * matching concept false. A hook that is declared but unreachable is a
+     * compile error rather than being skipped, see detail::DeclaresInit.
+     */
+    struct StaticThreadAccess
+    {
+        template <typename Derived>
+        static auto init(Derived& self) -> decltype(self.init()) { return self.init(); }
+
+        template <typename Derived>
+        static auto uninit(Derived& self) -> decltype(self.uninit()) { return self.uninit(); }
+
+        template <typename Derived>
+        static auto run(Derived& self) -> decltype(self.run()) { return self.run(); }
+
+        template <typename Derived>
+        static auto pre_run(Derived& self) -> decltype(self.pre_run()) { return self.pre_run(); }
+
+        template <typename Derived>
+        static auto post_run(Derived& self) -> decltype(self.post_run()) { return self.post_run(); }
+    };
+
+    namespace detail
+    {
+        template <typename Derived>
+        concept StaticRunHook = requires(Derived& self) { StaticThreadAccess::run(self); };
+
+        template <typename Derived>
+        concept StaticInitHook = requires(Derived& self) {
+            { StaticThreadAccess::init(self) } -> std::convertible_to<bool>;
+        };
+
+        template <typename Derived>
+        concept StaticUninitHook = requires(Derived& self) { StaticThreadAccess::uninit(self); };
+
+        template <typename Derived>
+        concept StaticPreRunHook = requires(Derived& self) { StaticThreadAccess::pre_run(self); };
+
+        template <typename Derived>
+        concept StaticPostRunHook = requires(Derived& self) { StaticThreadAccess::post_run(self); };
+
+        /** @brief One member per hook name, colliding with any Derived member of that name. */
+        struct StaticHookNames
+        {
+            void init ();
+            void uninit ();
+            void pre_run ();
+            void post_run ();
+        };
+
+        /**
+         * @brief Derived plus StaticHookNames: a hook name declared by Derived
+         *        (at any access level) makes the lookup ambiguous.
+         */
+        template <typename Derived>
+        struct StaticHookProbe : Derived, StaticHookNames
+        {
+        };
+
+        /**
+         * @brief Whether Derived declares a member named after a hook, reachable or not.
+         *
+         * Name lookup ignores access, so the ambiguity shows up for
+         * protected and private members too: a hook declared without
+         * @c friend @c StaticThreadAccess is caught instead of skipped.
+         * Final classes cannot be probed and are never reported.
+         */
+        template <typename Derived>
+        concept DeclaresInit = !std::is_final_v<Derived> && !requires { &StaticHookProbe<Derived>::init; };
+
+        template <typename Derived>
+        concept DeclaresUninit = !std::is_final_v<Derived> && !requires { &StaticHookProbe<Derived>::uninit; };
+
+        template <typename Derived>
+        concept DeclaresPreRun = !std::is_final_v<Derived> && !requires { &StaticHookProbe<Derived>::pre_run; };
+
+        template <typename Derived>
+        concept DeclaresPostRun = !std::is_final_v<Derived> && !requires { &StaticHookProbe<Derived>::post_run; };
+    }
+
+    /**
+     * @brief Thread whose loop is resolved at compile time.
+     *
+     * Same lifecycle as Thread (init, then pre_run/run/post_run until
+     * stopped, then uninit, with the same ThreadState transitions) but the
+     * hooks are called on @p Derived directly, so they can be inlined into
+     * the loop. @p Derived must provide run(); init(), uninit(), pre_run()
+     * and post_run() are optional and detected at compile time, a missing
+     * hook costs nothing.
+     *
+     * start/stop, the state word with its JoinHandle and the wake()/
+     * sleep_until() protocol are the ones of Thread (detail::ThreadCore).
+     * Everything that costs per-iteration work or a registry entry is left
+     * out: no affinity, scheduling, name or tid, no ThreadRegistry entry
+     * and therefore no Watchdog heartbeat, no last_cpu(), and the worker
+     * only waits through sleep_until() (no wait_readable()/wait_event()).
+     *
+     * Timing policies are layered as mixins between StaticThread and
+     * @p Derived, see StaticTimed and StaticHiResTimed. A hook declared by
+     * @p Derived hides the one of a mixin; call it explicitly to chain.
+     *
+     * @p Derived must call stop() in its destructor: the loop calls into
+     * it and must not outlive it.
+     */
+    template <typename Derived>
+    class StaticThread : private detail::ThreadCore
+    {
+    public:
+        StaticThread() = default;
+
+        ~StaticThread()
+        {
+            stop();
+        }
+
+        StaticThread(const StaticThread&) = delete;
+        StaticThread& operator=(const StaticThread&) = delete;
+
+        /**
+         * @brief Start the worker loop by spawning a new std::thread.
+         *
+         * @return true thread starts successfully
+         * @return false thread already running
+         */
+        bool start ()
+        {
+            return start_worker([this] { return std::thread(&StaticThread::loop, this); });
+        }
+
+        /**
+         * @brief Request the worker loop to stop and optionally join the thread.
+         *
+         * A worker blocked in sleep_until()/sleep_for() is woken up.
+         *
+         * @param wait_join join the internal thread before returning
+         */
+        void stop (bool wait_join = true)
+        {
+            request_stop();
+
+            if (wait_join)
+            {
+                join_worker();
+            }
+        }
+
+        /**
+         * @brief Ask the worker to stop without waiting for it, see Thread::request_stop().
+         *
+         * @return handle signalled when the loop has exited
+         */
+        Thread::JoinHandle request_stop ()
+        {
+            ThreadCore::request_stop();
+            wake();
+
+            return join_handle();
+        }
+
+        /** @brief Handle signalled when the current run of the loop exits. */
+        Thread::JoinHandle join_handle () const
+        {
+            return Thread::JoinHandle(this);
+        }
+
+        /** @brief Current lifecycle state. */
+        ThreadState state () const
+        {
+            return ThreadCore::state();
+        }
+
+        /**
+         * @brief Cut short the current (or next) sleep_until()/sleep_for().
+         *
+         * Wake-ups do not queue: several calls before the worker sleeps
+         * again collapse into one.
+         */
+        void wake ()
+        {
+            ThreadCore::wake();
+        }
+
+    protected:
+        /** @brief Whether stop() has been requested. */
+        bool stop_requested () const noexcept
+        {
+            return stop_flag_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Interruptible sleep of the worker until @p deadline.
+         *
+         * @c time_point::max() sleeps until woken, see wait_for_wake().
+         *
+         * @return true the deadline elapsed
+         * @return false woken early by wake() or stop()
+         */
+        bool sleep_until (std::chrono::steady_clock::time_point deadline)
+        {
+            return ThreadCore::sleep_until(deadline);
+        }
+
+        /** @brief Interruptible sleep of the worker for @p duration, see sleep_until(). */
+        bool sleep_for (std::chrono::steady_clock::duration duration)
+        {
+            return sleep_until(std::chrono::steady_clock::now() + duration);
+        }
+
+        /** @brief Block the worker until wake() or stop() is called. */
+        void wait_for_wake ()
+        {
+            sleep_until(std::chrono::steady_clock::time_point::max());
+        }
+
+    private:
+        void loop ()
+        {
+            static_assert(detail::StaticRunHook<Derived>,
+                          "StaticThread<Derived> requires Derived::run() (friend StaticThreadAccess if not public)");
+            static_assert(!detail::DeclaresInit<Derived> || detail::StaticInitHook<Derived>,
+                          "Derived::init() must return bool and be reachable (friend StaticThreadAccess if not public)");
+            static_assert(!detail::DeclaresUninit<Derived> || detail::StaticUninitHook<Derived>,
+                          "Derived::uninit() is not reachable (friend StaticThreadAccess if not public)");
+            static_assert(!detail::DeclaresPreRun<Derived> || detail::StaticPreRunHook<Derived>,
+                          "Derived::pre_run() is not reachable (friend StaticThreadAccess if not public)");
+            static_assert(!detail::DeclaresPostRun<Derived> || detail::StaticPostRunHook<Derived>,
+                          "Derived::post_run() is not reachable (friend StaticThreadAccess if not public)");
+
+            Derived& self = static_cast<Derived&>(*this);
+
+            if constexpr (detail::StaticInitHook<Derived>)
+            {
+                if (!StaticThreadAccess::init(self))
+                {
+                    stop_flag_.store(true, std::memory_order_release);
+                    set_state(ThreadState::FAILED_INIT);
+                    return;
+                }
+            }
+
+            transition(ThreadState::STARTING, ThreadState::RUNNING);
+
+            while (!stop_flag_.load(std::memory_order_acquire))
+            {
+                if constexpr (detail::StaticPreRunHook<Derived>)
+                {
+                    StaticThreadAccess::pre_run(self);
+
+                    // Same as Thread: no run() after a stop that ended a pre_run() wait.
+                    if (stop_flag_.load(std::memory_order_acquire))
+                    {
+                        break;
+                    }
+                }
+
+                StaticThreadAccess::run(self);
+
+                if constexpr (detail::StaticPostRunHook<Derived>)
+                {
+                    StaticThreadAccess::post_run(self);
+                }
+            }
+
+            set_state(ThreadState::STOPPING);
+
+            if constexpr (detail::StaticUninitHook<Derived>)
+            {
+                StaticThreadAccess::uninit(self);
+            }
+
+            set_state(ThreadState::STOPPED);
+        }
+    };
+
+    /**
+     * @brief Mixin sleeping a fixed delay before every iteration, like TimedThread.
+     *
+     * @code
+     * class Sampler : public StaticTimed<StaticThread<Sampler>> { ... };
+     * @endcode
+     */
+    template <typename Base>
+    class StaticTimed : public Base
+    {
+        friend struct StaticThreadAccess;
+
+    public:
+        /**
+         * @brief Construct the mixin; remaining arguments go to @p Base.
+         *
+         * @param micro_sec Delay expressed in microseconds. Values below zero
+         *                  are treated as zero (no sleep).
+         */
+        template <typename... Args>
+        explicit StaticTimed(int32_t micro_sec, Args&&... args)
+            : Base(std::forward<Args>(args)...)
+            , sleep_duration_(std::max<int32_t>(micro_sec, 0))
+        {
+        }
+
+    protected:
+        void pre_run ()
+        {
+            if (sleep_duration_.count() > 0)
+            {
+                this->sleep_for(sleep_duration_);
+            }
+        }
+
+    private:
+        std::chrono::microseconds sleep_duration_;
+    };
+
+    /**
+     * @brief Mixin keeping a fixed-rate loop on absolute deadlines, like HiResTimedThread.
+     *
+     * Only the default HiResTimedThread behaviour is provided (plain
+     * interruptible sleep, RESET_PHASE on overrun): the first iteration and
+     * an iteration late by a whole period or more restart the cadence from
+     * now. A wake() inserts an extra iteration without shifting the phase.
+     */
+    template <typename Base>
+    class StaticHiResTimed : public Base
+    {
+        friend struct StaticThreadAccess;
+
+    public:
+        /**
+         * @brief Construct the mixin; remaining arguments go to @p Base.
+         *
+         * @param micro_sec Loop period expressed in microseconds. Non-positive
+         *                  values disable the extra sleeping logic.
+         */
+        template <typename... Args>
+        explicit StaticHiResTimed(int32_t micro_sec, Args&&... args)
+            : Base(std::forward<Args>(args)...)
+            , loop_interval_(std::max<int32_t>(micro_sec, 0))
+            , next_deadline_{}
+        {
+        }
+
+    protected:
+        void pre_run ()
+        {
+            if (loop_interval_.count() == 0)
+            {
+                return;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+
+            if (next_deadline_ + loop_interval_ <= now)
+            {
+                next_deadline_ = now + loop_interval_;
+                return;
+            }
+
+            if (this->sleep_until(next_deadline_))
+            {
+                next_deadline_ += loop_interval_;
+            }
+        }
+
+    private:
+        std::chrono::microseconds loop_interval_;
+        std::chrono::steady_clock::time_point next_deadline_;
+    };
+}
@@ -7,11 +7,18 @@
 #pragma once
 
 #include <thread>
+#include <chrono>
 #include <cstdint>
 #include <pthread.h>
 #include <sched.h>
+#include <sys/types.h>
 #include <atomic>
 #include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <vms/core/thread_core.h>
 
 namespace vms::core
 {
@@ -21,15 +28,81 @@ namespace vms::core
         RR = SCHED_RR,
         FIFO = SCHED_FIFO,
         BATCH = SCHED_BATCH,
-        IDLE = SCHED_IDLE
+        IDLE = SCHED_IDLE,
+        DEADLINE = SCHED_DEADLINE
+    };
+
+    struct ThreadRegistrySlot;
+    class Event;
+    class BinarySemaphore;
+
+    template <typename Derived>
+    class StaticThread;
+
+    /**
+     * @brief Scheduling parameters of a single worker thread.
+     *
+     * @c priority is used by FIFO/RR, @c nice by OTHER/BATCH, while the
+     * runtime/deadline/period triple is only meaningful for DEADLINE (a zero
+     * period means "same as deadline").
+     */
+    struct ThreadScheduling
+    {
+        ThreadSchedulingPolicy policy = ThreadSchedulingPolicy::OTHER;
+        int priority = 0;
+        int nice = 0;
+        std::chrono::nanoseconds runtime{0};
+        std::chrono::nanoseconds deadline{0};
+        std::chrono::nanoseconds period{0};
     };
 
     /**
      * @brief Thread object providing a basic loop + lifecycle management.
      */
-    class Thread
+    class Thread : private detail::ThreadCore
     {
     public:
+        /** @brief Longest name the kernel keeps for a thread (TASK_COMM_LEN - 1). */
+        static constexpr std::size_t MAX_NAME_LENGTH = 15;
+
+        /**
+         * @brief Waitable view of a worker's exit, see join_handle().
+         *
+         * Waiting blocks on the state futex, not on the std::thread, so any
+         * number of threads can wait on any number of handles at once.
+         * A handle must not outlive its Thread (or StaticThread).
+         */
+        class JoinHandle
+        {
+        public:
+            JoinHandle() = default;
+
+            /** @brief Whether the handle refers to a Thread. */
+            bool valid () const noexcept;
+
+            /** @brief Whether the loop has exited (or never started). */
+            bool done () const noexcept;
+
+            /** @brief Block until the loop has exited. */
+            void wait () const;
+
+            /** @brief Block until the loop has exited or @p deadline; true when exited. */
+            bool wait_until (std::chrono::steady_clock::time_point deadline) const;
+
+            /** @brief Block for at most @p timeout; true when the loop has exited. */
+            bool wait_for (std::chrono::steady_clock::duration timeout) const;
+
+        private:
+            friend class Thread;
+
+            template <typename Derived>
+            friend class StaticThread;
+
+            explicit JoinHandle(const detail::ThreadCore* thread) noexcept;
+
+            const detail::ThreadCore* thread_ = nullptr;
+        };
+
         /** @brief Construct an idle thread object (no worker started yet). */
         Thread();
 
@@ -47,10 +120,165 @@ namespace vms::core
         /**
          * @brief Request the worker loop to stop and optionally join the thread.
          *
+         * A worker blocked in sleep_until()/sleep_for() is woken up, so the
+         * join does not wait for the remaining part of the sleep.
+         *
          * @param bWaitJoin join the internal thread before returning
          */
         void stop (bool bWaitJoin = true);
 
+        /**
+         * @brief Ask the worker to stop without waiting for it.
+         *
+         * Never blocks: sets the stop flag, wakes the worker and moves the
+         * state to STOPPING. The worker still has to be joined by stop()
+         * or the destructor, which is immediate once the handle is done.
+         *
+         * @return handle signalled when the loop has exited
+         */
+        JoinHandle request_stop ();
+
+        /** @brief Handle signalled when the current run of the loop exits. */
+        JoinHandle join_handle () const;
+
+        /**
+         * @brief Stop and join several workers in one pass.
+         *
+         * Every worker is asked to stop before any is waited for, so the
+         * total time is that of the slowest uninit() rather than the sum.
+         */
+        static void stop_all (std::span<Thread* const> threads);
+
+        /** @brief Current lifecycle state. */
+        ThreadState state () const;
+
+        /**
+         * @brief Cut short the current (or next) sleep_until()/sleep_for()/wait_readable()/wait_event().
+         *
+         * Wake-ups do not queue: several calls before the worker sleeps
+         * again collapse into one.
+         */
+        void wake ();
+
+        /**
+         * @brief Pin the worker to the CPUs contained in @p mask.
+         *
+         * The mask is stored and applied from inside the worker loop before
+         * init() runs, so init-time allocations are first-touched on the
+         * right NUMA node. When the worker is already running the mask is
+         * also applied immediately.
+         *
+         * @param mask CPU set to pin the worker to, must not be empty
+         * @return true mask stored (and applied, if running)
+         * @return false empty mask or the kernel rejected it
+         */
+        bool set_affinity (const cpu_set_t& mask);
+
+        /** @brief Convenience overload pinning the worker to a single CPU. */
+        bool set_affinity (int cpu);
+
+        /**
+         * @brief Forget the requested mask; future runs inherit the creator's
+         *        affinity. A running worker keeps its current placement.
+         */
+        void clear_affinity ();
+
+        /**
+         * @brief Retrieve the effective affinity mask.
+         *
+         * While the worker runs the mask is read back from the kernel,
+         * otherwise the requested mask (if any) is reported.
+         *
+         * @param mask receives the affinity mask
+         * @return true mask is available
+         * @return false not running and no mask requested, or query failed
+         */
+        bool get_affinity (cpu_set_t& mask) const;
+
+        /**
+         * @brief CPU the loop last ran on, -1 if it never ran.
+         *
+         * Read from /proc on each call while the worker runs, so the loop
+         * pays nothing for it; once stopped, the CPU it exited on.
+         */
+        int last_cpu () const;
+
+        /** @brief errno of the last failed affinity change, 0 when none. */
+        int affinity_error () const;
+
+        /**
+         * @brief Request a scheduling policy for this worker only.
+         *
+         * Unlike set_process_priority() the other threads of the process are
+         * left untouched. The request is applied from inside the loop (after
+         * the affinity, before init()) and immediately when already running.
+         * Failures never abort the worker: they are recorded and reported by
+         * scheduling_error().
+         *
+         * @param params requested policy and parameters
+         * @return true request stored (and applied, if running)
+         * @return false the kernel rejected the parameters on a running worker
+         */
+        bool set_scheduling (const ThreadScheduling& params);
+
+        /** @brief Forget the requested scheduling; future runs inherit it. */
+        void clear_scheduling ();
+
+        /**
+         * @brief Retrieve the scheduling of the worker.
+         *
+         * While running the parameters are read back from the kernel,
+         * otherwise the requested ones (if any) are reported.
+         *
+         * @param params receives the scheduling parameters
+         * @return true parameters are available
+         * @return false not running and nothing requested, or query failed
+         */
+        bool get_scheduling (ThreadScheduling& params) const;
+
+        /** @brief errno of the last failed scheduling change, 0 when none. */
+        int scheduling_error () const;
+
+        /**
+         * @brief Name the worker as shown by top -H, perf, gdb and /proc/<pid>/task/<tid>/comm.
+         *
+         * Names longer than MAX_NAME_LENGTH are truncated. The name is
+         * applied from inside the loop before init() and immediately when
+         * already running; an empty name leaves future runs with the
+         * creator's name.
+         *
+         * @param name requested name
+         * @return true name stored (and applied, if running)
+         * @return false the kernel rejected the name on a running worker
+         */
+        bool set_name (std::string_view name);
+
+        /** @brief Requested name, empty when none. */
+        std::string name () const;
+
+        /**
+         * @brief Kernel thread id of the running worker, 0 when not running.
+         *
+         * Matches the ids listed in /proc/<pid>/task and reported by perf.
+         */
+        pid_t tid () const;
+
+        /**
+         * @brief Longest time a single run() may take before the Watchdog reports it.
+         *
+         * Zero (the default) uses the watchdog's own budget,
+         * @c nanoseconds::max() exempts the thread. Takes effect immediately.
+         */
+        void set_watchdog_budget (std::chrono::nanoseconds budget);
+
+        /** @brief Requested watchdog budget, 0 when using the watchdog's default. */
+        std::chrono::nanoseconds watchdog_budget () const;
+
+        /**
+         * @brief Change the scheduling of the whole process (every thread).
+         *
+         * Prefer set_scheduling() to tune a single worker.
+         */
         static bool set_process_priority (int priority, ThreadSchedulingPolicy policy);
 
     protected:
@@ -63,26 +291,121 @@ namespace vms::core
         /** @brief Actual work for the thread body, must be implemented. */
         virtual void run() = 0;
 
-        /** @brief Hook invoked before each run() iteration. */
+        /** @brief Hook invoked before each run() iteration; run() is skipped when a stop arrives meanwhile. */
         virtual void pre_run();
 
         /** @brief Hook invoked after each run() iteration. */
         virtual void post_run();
 
+        /**
+         * @brief Interruptible sleep of the worker until @p deadline.
+         *
+         * @c time_point::max() sleeps until woken, see wait_for_wake().
+         *
+         * @return true the deadline elapsed
+         * @return false woken early by wake() or stop()
+         */
+        bool sleep_until (std::chrono::steady_clock::time_point deadline);
+
+        /** @brief Interruptible sleep of the worker for @p duration, see sleep_until(). */
+        bool sleep_for (std::chrono::steady_clock::duration duration);
+
+        /**
+         * @brief Block the worker until wake() or stop() is called.
+         *
+         * Returns immediately when a wake() is already pending.
+         */
+        void wait_for_wake ();
+
+        /**
+         * @brief Interruptible wait of the worker until @p fd is readable.
+         *
+         * The wait is cut short by wake() and stop() like sleep_until(), so
+         * subclasses can block on timers, sockets or pipes without delaying
+         * shutdown. When the internal eventfd is unavailable the wait polls
+         * in 10 ms slices instead, still interruptible.
+         *
+         * @return true @p fd is readable
+         * @return false woken early by wake() or stop()
+         */
+        bool wait_readable (int fd);
+
+        /**
+         * @brief Interruptible wait of the worker on @p event, see Event::wait_until().
+         *
+         * The wait is cut short by wake() and stop() like sleep_until().
+         * The syscall-free fast paths of Event are kept: set() only enters
+         * the kernel while the worker is actually blocked.
+         *
+         * @return true the event was set (and consumed in AUTO_RESET mode)
+         * @return false woken early by wake() or stop(), or @p deadline elapsed
+         */
+        bool wait_event (Event& event,
+                         std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+
+        /** @brief Interruptible BinarySemaphore::acquire(), see wait_event(). */
+        bool wait_acquire (BinarySemaphore& semaphore,
+                           std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+
     private:
         /**
          * @brief execution loop, the one that calls run() and check exit conditions
          * 
          */
-        void loop ();
+        void loop (ThreadRegistrySlot* slot);
+
+        /** @brief Release the ThreadRegistry entry of the ending run. */
+        void leave_registry (ThreadRegistrySlot* slot);
+
+        /** @brief Apply the requested affinity to the calling (worker) thread. */
+        void apply_affinity ();
+
+        /** @brief Apply the requested scheduling to the calling (worker) thread. */
+        void apply_scheduling ();
+
+        /** @brief Apply the requested name to the calling (worker) thread. */
+        void apply_name ();
+
+        /** @brief Event the worker is blocked on in wait_event(), interrupted by wake(). */
+        std::atomic<Event*> waited_event_;
+
+        /** @brief eventfd interrupting wait_readable(), created on first use. */
+        std::atomic<int> wake_fd_;
+
+        /** @brief errno of a failed write() to wake_fd_; later waits fall back to a bounded poll. */
+        std::atomic<int> wake_fd_error_;
+
+        /** @brief Requested affinity mask, guarded by state_mutex_. */
+        cpu_set_t affinity_mask_;
+
+        /** @brief Whether affinity_mask_ holds a request. */
+        bool has_affinity_;
+
+        /** @brief CPU observed when the loop started and when it exited. */
+        std::atomic<int> last_cpu_;
+
+        /** @brief errno of the last failed affinity change. */
+        std::atomic<int> affinity_error_;
+
+        /** @brief Requested scheduling, guarded by state_mutex_. */
+        ThreadScheduling scheduling_;
+
+        /** @brief Whether scheduling_ holds a request. */
+        bool has_scheduling_;
+
+        /** @brief errno of the last failed scheduling change. */
+        std::atomic<int> scheduling_error_;
+
+        /** @brief Kernel thread id of the running loop, 0 when not running. */
+        std::atomic<pid_t> tid_;
 
-        /** @brief Underlying std::thread handle. */
-        std::thread thread_;
+        /** @brief Requested name (NUL terminated, empty when none), guarded by state_mutex_. */
+        char name_[MAX_NAME_LENGTH + 1];
 
-        /** @brief Stop flag toggled by start()/stop(). */
-        std::atomic<bool> stop_flag_;
+        /** @brief ThreadRegistry entry of the current run, guarded by state_mutex_. */
+        ThreadRegistrySlot* registry_slot_;
 
-        /** @brief Protects thread_ and state transitions. */
-        mutable std::mutex state_mutex_;
+        /** @brief Requested watchdog budget, guarded by state_mutex_. */
+        std::chrono::nanoseconds watchdog_budget_;
     };
 }
@@ -0,0 +1,169 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace vms::core
+{
+    /** @brief Lifecycle state of a Thread's worker. */
+    enum class ThreadState : uint8_t
+    {
+        IDLE,           ///< never started
+        STARTING,       ///< spawned, running init()
+        RUNNING,        ///< inside the loop
+        STOPPING,       ///< stop requested or loop left, running uninit()
+        STOPPED,        ///< loop exited after uninit()
+        FAILED_INIT     ///< loop exited because init() returned false
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Lifecycle and wake-up machinery shared by Thread and StaticThread.
+         *
+         * Owns the std::thread, the stop flag, the state futex word (state
+         * transitions and JoinHandle waiters) and the wake futex word
+         * (wake()/sleep_until() handshake). Not polymorphic: both classes
+         * inherit it privately and drive their own loop.
+         */
+        class ThreadCore
+        {
+        public:
+            /** @brief wake_word_ bit set by wake(), consumed by the sleeping worker. */
+            static constexpr uint32_t WAKE_PENDING = 1u;
+
+            /** @brief wake_word_ bit set while the worker is (about to be) blocked on the futex. */
+            static constexpr uint32_t SLEEPING = 2u;
+
+            /** @brief wake_word_ bit set while the worker is (about to be) blocked in poll(). */
+            static constexpr uint32_t POLLING = 4u;
+
+            /** @brief wake_word_ bit set while the worker is (about to be) blocked in wait_event(). */
+            static constexpr uint32_t EVENT_WAITING = 8u;
+
+            /** @brief wake_word_ bit set by wake() once it no longer touches the waited Event. */
+            static constexpr uint32_t INTERRUPT_DONE = 16u;
+
+            /** @brief state_word_ bits holding the ThreadState. */
+            static constexpr uint32_t STATE_MASK = 0xffu;
+
+            /** @brief state_word_ bit set while a JoinHandle is (about to be) blocked on the futex. */
+            static constexpr uint32_t STATE_WAITERS = 0x100u;
+
+            ThreadCore();
+
+            ThreadCore(const ThreadCore&) = delete;
+            ThreadCore& operator=(const ThreadCore&) = delete;
+
+            /** @brief Whether @p state means the loop is not running (never started or exited). */
+            static bool is_exited (ThreadState state) noexcept;
+
+            /** @brief Current lifecycle state. */
+            ThreadState state () const;
+
+            /** @brief Wait for the loop to exit, see Thread::JoinHandle::wait_until(). */
+            bool wait_exit (std::chrono::steady_clock::time_point deadline) const;
+
+        protected:
+            /**
+             * @brief Spawn the worker with the std::thread returned by @p spawn.
+             *
+             * A loop that already exited is reaped first. @p spawn runs with
+             * state_mutex_ held; when it throws the state is rolled back to
+             * STOPPED and the exception propagates.
+             *
+             * @return false the worker is still running
+             */
+            template <typename Spawn>
+            bool start_worker (Spawn&& spawn)
+            {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+
+                if (thread_.joinable())
+                {
+                    // A loop that already exited (request_stop() without a join)
+                    // is reaped here, anything else is still running.
+                    if (!is_exited(state()))
+                    {
+                        return false;
+                    }
+
+                    thread_.join();
+                }
+
+                // Flag first: a request_stop() that sees STARTING must find a
+                // flag it can raise, not one start_worker() clears afterwards.
+                stop_flag_.store(false, std::memory_order_release);
+                wake_word_.store(0, std::memory_order_relaxed);
+                set_state(ThreadState::STARTING);
+
+                try
+                {
+                    thread_ = spawn();
+                }
+                catch (...)
+                {
+                    stop_flag_.store(true, std::memory_order_release);
+                    set_state(ThreadState::STOPPED);
+                    throw;
+                }
+
+                return true;
+            }
+
+            /** @brief Raise the stop flag and move the state to STOPPING; the caller wakes the worker. */
+            void request_stop ();
+
+            /** @brief Join the worker, unless called from the worker itself. */
+            void join_worker ();
+
+            /**
+             * @brief Post a wake-up, releasing a worker blocked in sleep_until().
+             *
+             * @return previous wake_word_, for the caller to interrupt the
+             *         other kinds of waits
+             */
+            uint32_t wake ();
+
+            /**
+             * @brief Interruptible sleep of the worker until @p deadline.
+             *
+             * @c time_point::max() sleeps until woken.
+             *
+             * @return true the deadline elapsed
+             * @return false woken early by wake() or stop()
+             */
+            bool sleep_until (std::chrono::steady_clock::time_point deadline);
+
+            /** @brief Publish @p state, waking JoinHandle waiters. */
+            void set_state (ThreadState state);
+
+            /** @brief Move from @p from to @p to; false when the state was not @p from. */
+            bool transition (ThreadState from, ThreadState to);
+
+            /** @brief Underlying std::thread handle. */
+            std::thread thread_;
+
+            /** @brief Stop flag toggled by start()/stop(). */
+            std::atomic<bool> stop_flag_;
+
+            /** @brief ThreadState in the low byte plus STATE_WAITERS (futex word). */
+            mutable std::atomic<uint32_t> state_word_;
+
+            /** @brief Futex word combining the WAKE_PENDING, SLEEPING, POLLING and EVENT_WAITING bits. */
+            std::atomic<uint32_t> wake_word_;
+
+            /** @brief Protects thread_ and state transitions. */
+            mutable std::mutex state_mutex_;
+        };
+    }
+}
@@ -0,0 +1,399 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <vms/core/cpu.h>
+#include <vms/core/futex.h>
+#include <vms/core/mpmc_queue.h>
+#include <vms/core/thread_base.h>
+#include <vms/core/work_stealing_deque.h>
+
+namespace vms::core
+{
+    class ThreadPool;
+
+    template <typename R>
+    class TaskFuture;
+
+    namespace detail
+    {
+        /**
+         * @brief Reference counted unit of work queued by ThreadPool.
+         *
+         * The queue and the TaskFuture each own one reference, so the task
+         * and its result share a single allocation.
+         */
+        class TaskNode
+        {
+        public:
+            virtual ~TaskNode() = default;
+
+            /** @brief Run the task, publish its outcome and drop the queue's reference. */
+            virtual void execute () noexcept = 0;
+
+            void retain () noexcept
+            {
+                refs_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void release () noexcept
+            {
+                if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    delete this;
+                }
+            }
+
+        private:
+            std::atomic<uint32_t> refs_{1};
+        };
+
+        /** @brief Result slot of a task plus a futex word to wait on it. */
+        template <typename R>
+        class FutureState : public TaskNode
+        {
+        public:
+            using Value = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+
+            bool ready () const noexcept
+            {
+                return state_.load(std::memory_order_acquire) == READY;
+            }
+
+            void wait () noexcept
+            {
+                while (!ready())
+                {
+                    uint32_t expected = PENDING;
+                    state_.compare_exchange_strong(expected, WAITED, std::memory_order_acq_rel);
+
+                    if (expected != READY)
+                    {
+                        futex_wait(state_, WAITED);
+                    }
+                }
+            }
+
+            bool wait_until (std::chrono::steady_clock::time_point deadline) noexcept
+            {
+                while (!ready())
+                {
+                    uint32_t expected = PENDING;
+                    state_.compare_exchange_strong(expected, WAITED, std::memory_order_acq_rel);
+
+                    if (expected != READY && !futex_wait_until(state_, WAITED, deadline))
+                    {
+                        return ready();
+                    }
+                }
+
+                return true;
+            }
+
+            R take ()
+            {
+                if (error_)
+                {
+                    std::rethrow_exception(error_);
+                }
+
+                if constexpr (!std::is_void_v<R>)
+                {
+                    return std::move(*value_);
+                }
+            }
+
+        protected:
+            template <typename F>
+            void complete (F& fn) noexcept
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        fn();
+                    }
+                    else
+                    {
+                        value_.emplace(fn());
+                    }
+                }
+                catch (...)
+                {
+                    error_ = std::current_exception();
+                }
+
+                // Only pay for the wake-up when someone is blocked on the result.
+                if (state_.exchange(READY, std::memory_order_acq_rel) == WAITED)
+                {
+                    futex_wake_all(state_);
+                }
+            }
+
+        private:
+            static constexpr uint32_t PENDING = 0;
+            static constexpr uint32_t READY = 1;
+            static constexpr uint32_t WAITED = 2;
+
+            std::atomic<uint32_t> state_{PENDING};
+            std::optional<Value> value_;
+            std::exception_ptr error_;
+        };
+
+        template <typename R, typename F>
+        class TaskState final : public FutureState<R>
+        {
+        public:
+            explicit TaskState(F&& fn)
+                : fn_(std::move(fn))
+            {
+            }
+
+            void execute () noexcept override
+            {
+                this->complete(fn_);
+                this->release();
+            }
+
+        private:
+            F fn_;
+        };
+    }
+
+    /**
+     * @brief Fixed-size work-stealing thread pool.
+     *
+     * Each worker is a Thread owning a Chase-Lev deque: tasks submitted from
+     * a worker go to its own deque, tasks submitted from outside go to a
+     * global injection queue. Idle workers look in their deque, then in the
+     * injection queue, then steal from their peers, and finally park on a
+     * futex until new work is submitted.
+     *
+     * Tasks still queued when the pool stops are run by stop() on the
+     * calling thread, so no TaskFuture is left pending.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Create the pool (workers are not started).
+         *
+         * @param worker_count number of workers, at least 1
+         * @param queue_capacity capacity of the injection queue and of each worker deque
+         */
+        explicit ThreadPool(std::size_t worker_count, std::size_t queue_capacity = 4096);
+
+        /** @brief Stop the workers, running any task left in the queues. */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Start every worker.
+         *
+         * @return true workers started
+         * @return false already running
+         */
+        bool start ();
+
+        /** @brief Stop and join the workers, then drain the queues on the caller. */
+        void stop ();
+
+        /** @brief Number of workers. */
+        std::size_t size () const noexcept;
+
+        /**
+         * @brief Access a worker, e.g. to set its affinity or scheduling before start().
+         */
+        Thread& worker (std::size_t index);
+
+        /**
+         * @brief Queue @p fn for execution.
+         *
+         * Tasks submitted while the pool is stopped wait for start() (or
+         * the next stop() drain). When the injection queue is full the task
+         * is run inline by the caller, which throttles producers.
+         *
+         * @return handle to wait for the result
+         */
+        template <typename F>
+        auto submit (F&& fn) -> TaskFuture<std::invoke_result_t<std::decay_t<F>&>>
+        {
+            using R = std::invoke_result_t<std::decay_t<F>&>;
+
+            auto* task = new detail::TaskState<R, std::decay_t<F>>(std::decay_t<F>(std::forward<F>(fn)));
+            task->retain();
+
+            enqueue(task);
+            return TaskFuture<R>(task);
+        }
+
+        /** @brief Whether the caller is a worker of some ThreadPool. */
+        static bool on_worker () noexcept;
+
+        /**
+         * @brief From a worker: run one queued task of its pool, or yield if none.
+         *
+         * Used by TaskFuture to keep a waiting worker productive.
+         */
+        static void help_or_yield () noexcept;
+
+    private:
+        class Worker;
+
+        /** @brief Push to the local deque or the injection queue and wake a parked worker. */
+        void enqueue (detail::TaskNode* task);
+
+        /** @brief Next task for @p self: own deque, injection queue, then peers. */
+        detail::TaskNode* find_task (Worker& self);
+
+        /** @brief Park the calling worker until new work is published or the pool stops. */
+        void park ();
+
+        /** @brief Wake one parked worker, if any. */
+        void wake_one ();
+
+        /** @brief Whether any queue looks non-empty. */
+        bool has_work () const;
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+        MpmcQueue<detail::TaskNode*> injection_;
+
+        /** @brief Whether workers may keep running, read when parking. */
+        std::atomic<bool> running_;
+
+        /** @brief Bumped on every publication a parked worker may care about (futex word). */
+        alignas(cache_line_size) std::atomic<uint32_t> epoch_;
+
+        /** @brief Number of workers parked (or about to park) on epoch_. */
+        alignas(cache_line_size) std::atomic<uint32_t> parked_;
+    };
+
+    /**
+     * @brief Result handle returned by ThreadPool::submit().
+     *
+     * Shares the task allocation; waiting blocks on a futex only when the
+     * result is not ready yet, and completion only issues a wake-up syscall
+     * when a waiter is registered.
+     */
+    template <typename R>
+    class TaskFuture
+    {
+    public:
+        TaskFuture() = default;
+
+        ~TaskFuture()
+        {
+            if (state_ != nullptr)
+            {
+                state_->release();
+            }
+        }
+
+        TaskFuture(TaskFuture&& other) noexcept
+            : state_(std::exchange(other.state_, nullptr))
+        {
+        }
+
+        TaskFuture& operator=(TaskFuture&& other) noexcept
+        {
+            if (this != &other)
+            {
+                TaskFuture discarded(std::move(*this));
+                state_ = std::exchange(other.state_, nullptr);
+            }
+
+            return *this;
+        }
+
+        TaskFuture(const TaskFuture&) = delete;
+        TaskFuture& operator=(const TaskFuture&) = delete;
+
+        /** @brief Whether the handle refers to a task. */
+        bool valid () const noexcept
+        {
+            return state_ != nullptr;
+        }
+
+        /** @brief Whether the task has completed. */
+        bool ready () const noexcept
+        {
+            return state_ != nullptr && state_->ready();
+        }
+
+        /**
+         * @brief Block until the task has completed.
+         *
+         * On a pool worker the wait runs other queued tasks instead of
+         * blocking, so tasks may wait on the tasks they submit.
+         */
+        void wait () const noexcept
+        {
+            if (!ThreadPool::on_worker())
+            {
+                state_->wait();
+                return;
+            }
+
+            while (!state_->ready())
+            {
+                ThreadPool::help_or_yield();
+            }
+        }
+
+        /** @brief Wait for at most @p timeout (helping on a worker); true when the task has completed. */
+        template <typename Rep, typename Period>
+        bool wait_for (std::chrono::duration<Rep, Period> timeout) const noexcept
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+            if (!ThreadPool::on_worker())
+            {
+                return state_->wait_until(deadline);
+            }
+
+            while (!state_->ready() && std::chrono::steady_clock::now() < deadline)
+            {
+                ThreadPool::help_or_yield();
+            }
+
+            return state_->ready();
+        }
+
+        /** @brief Wait and return the result, rethrowing the task's exception. Single use. */
+        R get ()
+        {
+            wait();
+            TaskFuture consumed(std::move(*this));
+            return consumed.state_->take();
+        }
+
+    private:
+        friend class ThreadPool;
+
+        explicit TaskFuture(detail::FutureState<R>* state) noexcept
+            : state_(state)
+        {
+        }
+
+        detail::FutureState<R>* state_ = nullptr;
+    };
+}
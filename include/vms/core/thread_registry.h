@@ -0,0 +1,138 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <sys/types.h>
+#include <vector>
+
+#include <vms/core/cpu.h>
+#include <vms/core/thread_base.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Registry entry of one running Thread.
+     *
+     * Every field is written by its owner with relaxed stores and read by
+     * ThreadRegistry::snapshot() without locking; @c serial changes every
+     * time the slot is claimed or released, so readers detect reuse.
+     */
+    struct alignas(cache_line_size) ThreadRegistrySlot
+    {
+        std::atomic<bool> in_use{false};
+        std::atomic<uint64_t> serial{0};
+        std::atomic<const Thread*> thread{nullptr};
+        std::atomic<pid_t> tid{0};
+        std::atomic<clockid_t> cpu_clock{0};
+        std::atomic<bool> has_cpu_clock{false};
+        std::atomic<ThreadState> state{ThreadState::IDLE};
+        /**
+         * @brief Loop heartbeat: completed iterations << 1, low bit set while inside run().
+         *
+         * Updated with one relaxed store right before and one right after run().
+         */
+        std::atomic<uint64_t> heartbeat{0};
+
+        /** @brief Stall budget of the thread for the Watchdog, 0 for the watchdog's default. */
+        std::atomic<int64_t> watchdog_budget_ns{0};
+
+        /** @brief Thread name packed in two words (NUL padded). */
+        std::array<std::atomic<uint64_t>, 2> name{};
+    };
+
+    /** @brief Point-in-time view of a registered Thread. */
+    struct ThreadInfo
+    {
+        /** @brief Identity of the Thread object; compare only, never dereference. */
+        const Thread* thread = nullptr;
+
+        /** @brief Registration number, unique for every start() of every Thread. */
+        uint64_t serial = 0;
+
+        /** @brief Name as set by Thread::set_name(), NUL terminated. */
+        char name[Thread::MAX_NAME_LENGTH + 1] = {};
+
+        /** @brief Kernel thread id, 0 while the worker is still being spawned. */
+        pid_t tid = 0;
+
+        ThreadState state = ThreadState::IDLE;
+
+        /** @brief Loop iterations completed in the current run. */
+        uint64_t iterations = 0;
+
+        /** @brief Whether the loop was inside run() when sampled. */
+        bool in_run = false;
+
+        /** @brief CPU time consumed by the worker. */
+        std::chrono::nanoseconds cpu_time{0};
+
+        /** @brief Context switches, only filled when requested from snapshot(). */
+        uint64_t voluntary_switches = 0;
+        uint64_t involuntary_switches = 0;
+    };
+
+    /**
+     * @brief Process-wide table of the running Thread objects.
+     *
+     * Thread::start() claims one of CAPACITY static slots with a CAS and the
+     * loop releases it when it exits; neither side ever locks or allocates.
+     * When the table is full the thread runs unregistered and dropped()
+     * is incremented.
+     *
+     * snapshot() walks the slots with plain atomic loads, plus one
+     * clock_gettime() per thread and, optionally, one read of
+     * /proc/self/task/<tid>/status for the context switch counters.
+     */
+    class ThreadRegistry
+    {
+    public:
+        /** @brief Maximum number of threads registered at the same time. */
+        static constexpr std::size_t CAPACITY = 1024;
+
+        /**
+         * @brief Fill @p out with the registered threads.
+         *
+         * @param out receives one entry per thread, cleared first (reuse it
+         *            across calls to avoid reallocations)
+         * @param context_switches also read the context switch counters
+         * @return number of entries written
+         */
+        static std::size_t snapshot (std::vector<ThreadInfo>& out, bool context_switches = true);
+
+        /** @brief Number of threads currently registered. */
+        static std::size_t size ();
+
+        /** @brief Registrations refused because the table was full. */
+        static uint64_t dropped ();
+
+    private:
+        friend class Thread;
+        friend class Watchdog;
+
+        /** @brief Slot @p index of the table, for scanners that keep per-slot state. */
+        static const ThreadRegistrySlot& slot_at (std::size_t index);
+
+        /** @brief Claim a slot for @p thread; the shared overflow slot when full. */
+        static ThreadRegistrySlot* acquire (const Thread* thread, const char* name,
+                                            std::chrono::nanoseconds watchdog_budget);
+
+        /** @brief Release a slot returned by acquire(). */
+        static void release (ThreadRegistrySlot* slot);
+
+        /** @brief Store @p name in @p slot. */
+        static void store_name (ThreadRegistrySlot* slot, const char* name);
+
+        /** @brief Whether @p slot is the shared overflow slot. */
+        static bool is_overflow (const ThreadRegistrySlot* slot);
+    };
+}
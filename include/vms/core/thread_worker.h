@@ -9,15 +9,97 @@
 #include <chrono>
 
 #include <vms/core/thread_base.h>
+#include <vms/core/loop_statistics.h>
 
 namespace vms::core
 {
+    /**
+     * @brief How HiResTimedThread waits for its next deadline.
+     */
+    enum class TimerPrecision : int
+    {
+        /** Sleep until the deadline; accuracy bounded by the kernel timer slack. */
+        SLEEP,
+        /** Sleep until a calibrated margin before the deadline, then spin. */
+        HYBRID
+    };
+
+    /**
+     * @brief Time source driving the HiResTimedThread period.
+     */
+    enum class TimerBackend : int
+    {
+        /** Deadlines computed in user space on steady_clock. */
+        STEADY_CLOCK,
+        /** Periodic kernel timerfd on CLOCK_MONOTONIC keeps the cadence and counts expirations. */
+        TIMERFD
+    };
+
+    /**
+     * @brief What HiResTimedThread does when run() ends past the next slot.
+     */
+    enum class OverrunPolicy : int
+    {
+        /** Run at once and restart the period from there (phase drifts). */
+        RESET_PHASE,
+        /** Drop the late slot and wait for the next aligned one (phase kept). */
+        SKIP,
+        /** Run the missed slots back-to-back, at most catch_up_limit() of them (phase kept). */
+        CATCH_UP
+    };
+
+    /**
+     * @brief How PollingThread waits when poll() found nothing to do.
+     */
+    enum class IdleStrategy : int
+    {
+        /** Spin with a PAUSE hint: lowest latency, one core always busy. */
+        BUSY_SPIN,
+        /** Spin, then interruptible sleeps doubling up to the maximum backoff. */
+        BACKOFF,
+        /** Spin, then sched_yield() on every idle round. */
+        SPIN_YIELD,
+        /** Spin, yield, then park on a futex until notify() (or the park timeout). */
+        SPIN_PARK
+    };
+
+    /**
+     * @brief Tuning of a PollingThread idle strategy.
+     */
+    struct IdleConfig
+    {
+        IdleStrategy strategy = IdleStrategy::SPIN_PARK;
+        /** @brief Idle rounds spent spinning before escalating. */
+        uint32_t spin_rounds = 128;
+        /** @brief Idle rounds spent yielding before parking (SPIN_PARK only). */
+        uint32_t yield_rounds = 16;
+        /** @brief Longest BACKOFF sleep. */
+        std::chrono::microseconds max_backoff{1000};
+        /** @brief Upper bound of a SPIN_PARK park, zero parks until notify(). */
+        std::chrono::microseconds park_timeout{0};
+    };
+
+    /**
+     * @brief Per-iteration timing information handed to HiResTimedThread subclasses.
+     */
+    struct IterationContext
+    {
+        /** @brief Iterations started since the worker (re)started, 0-based. */
+        uint64_t index = 0;
+        /** @brief Periods that elapsed without an iteration right before this one. */
+        uint64_t missed_ticks = 0;
+        /** @brief Slot this iteration was scheduled for. */
+        std::chrono::steady_clock::time_point deadline{};
+    };
+
     /**
      * @brief Periodically sleeps before each iteration of the worker loop.
      *
      * The class simply enforces a fixed delay (in microseconds) right before
      * @ref Thread::run is invoked. It is useful when the actual run()
      * implementation represents a burst of work that must be throttled.
+     * The delay is interruptible: wake() runs the next iteration right away
+     * and stop() does not wait for the delay to expire.
      */
     class TimedThread : public Thread
     {
@@ -43,7 +125,9 @@ namespace vms::core
      *
      * After each iteration the class compensates for the work time in order
      * to maintain the requested period. High precision is achieved by using
-     * @c std::chrono::steady_clock and @c sleep_until.
+     * @c std::chrono::steady_clock and an absolute, interruptible
+     * @ref Thread::sleep_until. A wake() inserts an extra iteration without
+     * shifting the phase of the following ones.
      */
     class HiResTimedThread : public Thread
     {
@@ -57,7 +141,97 @@ namespace vms::core
         explicit HiResTimedThread(int32_t micro_sec);
         ~HiResTimedThread() override = default;
 
+        /**
+         * @brief Select how the deadline is waited for; can change at runtime.
+         *
+         * HYBRID trades CPU for jitter: the worker sleeps until
+         * spin_margin() before the deadline and busy-waits the rest.
+         */
+        void set_precision (TimerPrecision precision);
+
+        /** @brief Currently selected precision mode. */
+        TimerPrecision precision () const;
+
+        /**
+         * @brief Spin window used by HYBRID mode.
+         *
+         * Starts from a conservative default and is calibrated on the
+         * observed oversleep: it grows at once on a late wake-up and decays
+         * slowly while the kernel is punctual.
+         */
+        std::chrono::nanoseconds spin_margin () const;
+
+        /**
+         * @brief Select the time source; takes effect at the next start().
+         *
+         * TIMERFD lets the kernel keep the cadence: the worker is woken by
+         * the timer expirations instead of computing each sleep itself.
+         * Skipped periods are reported in IterationContext::missed_ticks with
+         * both backends.
+         */
+        void set_backend (TimerBackend backend);
+
+        /**
+         * @brief Selected time source.
+         *
+         * Reports STEADY_CLOCK after the worker had to fall back because the
+         * timerfd could not be created or failed while running.
+         */
+        TimerBackend backend () const;
+
+        /** @brief errno of the last timerfd failure that forced the fallback, 0 when none. */
+        int timer_error () const;
+
+        /** @brief Select the overrun handling; can change at runtime. */
+        void set_overrun_policy (OverrunPolicy policy);
+
+        /** @brief Currently selected overrun handling (RESET_PHASE by default). */
+        OverrunPolicy overrun_policy () const;
+
+        /**
+         * @brief Bound the CATCH_UP burst; older missed slots are dropped.
+         *
+         * @param max_burst extra back-to-back iterations per overrun
+         *                  (unlimited by default)
+         */
+        void set_catch_up_limit (uint32_t max_burst);
+
+        /** @brief Current CATCH_UP burst limit. */
+        uint32_t catch_up_limit () const;
+
+        /** @brief Number of overruns detected since construction. */
+        uint64_t overrun_count () const;
+
+        /**
+         * @brief Turn the built-in timing statistics on or off at runtime.
+         *
+         * When disabled the loop only pays for one relaxed load per
+         * iteration; when enabled two clock reads and a few relaxed stores,
+         * never an allocation.
+         */
+        void enable_statistics (bool enabled = true);
+
+        /** @brief Whether statistics are being collected. */
+        bool statistics_enabled () const;
+
+        /** @brief Copy of the statistics; callable from any thread while running. */
+        LoopStatisticsSnapshot statistics () const;
+
+        /** @brief Clear the statistics; applied by the worker before its next sample. */
+        void reset_statistics ();
+
     protected:
+        /** @brief Timing information of the iteration being run. */
+        const IterationContext& iteration_context () const noexcept;
+
+        /**
+         * @brief Invoked on the worker when an overrun is detected.
+         *
+         * Runs right before the late iteration, @p context already describes
+         * it (slot and missed ticks after the policy has been applied).
+         */
+        virtual void on_overrun (const IterationContext& context);
+
         /** @brief Capture the new deadline at the beginning of each loop. */
         void pre_run() override;
         /** @brief Sleep until the next deadline, compensating for work duration. */
@@ -68,8 +242,183 @@ namespace vms::core
     private:
         using Clock = std::chrono::steady_clock;
 
+        /**
+         * @brief Wait for @p deadline according to the precision mode.
+         *
+         * @return false when the wait was interrupted by wake() or stop()
+         */
+        bool wait_deadline (Clock::time_point deadline);
+
+        /**
+         * @brief Number of slots from next_deadline_ onwards that are already due.
+         *
+         * TIMERFD derives it from the kernel expiration count; the clock is
+         * read into @p now (when still unset) only on STEADY_CLOCK or when a
+         * HYBRID lead makes the count ambiguous.
+         */
+        uint64_t elapsed_slots (Clock::time_point& now);
+
+        /** @brief Fold the oversleep of the last HYBRID sleep into the margin. */
+        void calibrate_margin (std::chrono::nanoseconds oversleep);
+
+        /** @brief Wait for @p slot on the active backend; false when interrupted. */
+        bool wait_slot (Clock::time_point slot);
+
+        /** @brief Create the timerfd and arm it on the current deadline grid. */
+        bool open_timer ();
+
+        /** @brief (Re)arm the timer on the grid starting at @p first_slot, @p lead ahead of each slot. */
+        bool arm_timer (Clock::time_point first_slot, std::chrono::nanoseconds lead);
+
+        /** @brief TIMERFD flavour of wait_slot(). */
+        bool wait_timer (Clock::time_point slot);
+
+        /**
+         * @brief Consume the pending expirations without blocking, advancing timer_next_.
+         *
+         * @return false the timerfd failed and the worker fell back to STEADY_CLOCK
+         */
+        bool drain_timer ();
+
+        /** @brief Record @p error, close the timerfd and switch to STEADY_CLOCK. */
+        void fail_timer (int error);
+
+        /** @brief Timer lead wanted by the current precision mode. */
+        std::chrono::nanoseconds desired_lead () const;
+
         std::chrono::microseconds loop_interval_;
+        std::atomic<TimerPrecision> precision_;
+        std::atomic<int64_t> spin_margin_ns_;
+        std::atomic<TimerBackend> backend_;
+        TimerBackend active_backend_;
+        int timer_fd_;
+        std::atomic<int> timer_error_;
+        std::chrono::nanoseconds timer_lead_;
+        Clock::time_point timer_next_;
+        std::atomic<OverrunPolicy> overrun_policy_;
+        std::atomic<uint32_t> catch_up_limit_;
+        std::atomic<uint64_t> overrun_count_;
+        uint32_t catch_up_remaining_;
+        LoopStatistics statistics_;
+        std::atomic<bool> statistics_enabled_;
+        Clock::time_point run_start_;
+        Clock::time_point previous_start_;
+        IterationContext context_;
         Clock::time_point next_deadline_;
         bool first_iteration_;
     };
+
+    /**
+     * @brief Worker that sleeps until a producer signals pending work.
+     *
+     * Each iteration blocks in pre_run() until notify() is called, then
+     * invokes run() once. Notifications are coalesced: any number of
+     * notify() calls issued while the worker is busy result in a single
+     * further run(), so run() must drain all the work available. A stop
+     * ends the wait without a further run().
+     *
+     * notify() only enters the kernel when the worker is actually asleep.
+     */
+    class EventThread : public Thread
+    {
+    public:
+        EventThread() = default;
+        ~EventThread() override = default;
+
+        /** @brief Signal pending work; callable from any thread. */
+        void notify ();
+
+    protected:
+        /** @brief Wait for the next notification. */
+        void pre_run() override;
+    };
+
+    /**
+     * @brief Worker polling for work with a configurable idle strategy.
+     *
+     * Subclasses implement poll() instead of run() and report whether any
+     * work was found: busy rounds run back-to-back, idle rounds escalate
+     * along the selected IdleStrategy and the first busy round resets it.
+     * Producers call notify() after publishing work so a parked worker
+     * resumes immediately; the call is free while the worker is not parked.
+     */
+    class PollingThread : public Thread
+    {
+    public:
+        explicit PollingThread(const IdleConfig& config = IdleConfig{});
+        ~PollingThread() override = default;
+
+        /** @brief Change the idle strategy; picked up at the next idle round. */
+        void set_idle_config (const IdleConfig& config);
+
+        /** @brief Current idle strategy. */
+        IdleConfig idle_config () const;
+
+        /** @brief Wake the worker if it is parked or backing off. */
+        void notify ();
+
+    protected:
+        /**
+         * @brief Look for work and process it.
+         *
+         * @return true some work was done, poll again right away
+         * @return false nothing to do, let the idle strategy back off
+         */
+        virtual bool poll() = 0;
+
+        /** @brief Calls poll() and backs off when it reports no work. */
+        void run() final;
+
+    private:
+        /** @brief Wait according to the strategy after idle_rounds_ empty polls. */
+        void idle ();
+
+        std::atomic<IdleStrategy> strategy_;
+        std::atomic<uint32_t> spin_rounds_;
+        std::atomic<uint32_t> yield_rounds_;
+        std::atomic<int64_t> max_backoff_us_;
+        std::atomic<int64_t> park_timeout_us_;
+        uint32_t idle_rounds_;
+    };
+
+    /**
+     * @brief Polling worker handing run_batch() a budget of items per iteration.
+     *
+     * Each loop iteration costs the stop-flag load and the virtual hook
+     * calls once per batch instead of once per item. run_batch() should
+     * process at most @c budget items and return how many it handled;
+     * returning 0 lets the PollingThread idle strategy back off. The stop
+     * request is only observed between batches, so the budget also bounds
+     * the stop latency.
+     */
+    class BatchedThread : public PollingThread
+    {
+    public:
+        explicit BatchedThread(std::size_t batch_size, const IdleConfig& config = IdleConfig{});
+        ~BatchedThread() override = default;
+
+        /** @brief Change the per-iteration budget (at least 1); picked up at the next batch. */
+        void set_batch_size (std::size_t batch_size);
+
+        /** @brief Current per-iteration budget. */
+        std::size_t batch_size () const;
+
+        /** @brief Items reported by run_batch() since construction. */
+        uint64_t processed_count () const;
+
+    protected:
+        /**
+         * @brief Process up to @p budget items.
+         *
+         * @return number of items processed, 0 when there was nothing to do
+         */
+        virtual std::size_t run_batch(std::size_t budget) = 0;
+
+        /** @brief Runs one batch. */
+        bool poll() final;
+
+    private:
+        std::atomic<std::size_t> batch_size_;
+        std::atomic<uint64_t> processed_;
+    };
 }
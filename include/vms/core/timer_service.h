@@ -0,0 +1,205 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vms/core/inplace_function.h>
+#include <vms/core/thread_worker.h>
+
+namespace vms::core
+{
+    class ThreadPool;
+
+    /**
+     * @brief Many one-shot and periodic timers multiplexed on one worker.
+     *
+     * The worker is a HiResTimedThread ticking every @c tick; timers live
+     * in a hierarchical timing wheel (4 levels of 256 slots, Varghese and
+     * Lauck) so that schedule and cancel are O(1). Instead of cascading a
+     * whole upper slot when a level wraps around, each upper slot is
+     * drained into the level below a little at every tick during the slot
+     * period that precedes it, so the per-tick cost stays proportional to
+     * the timers firing rather than spiking every 256 ticks.
+     *
+     * Expiries are rounded up to the tick: a timer never fires early, and
+     * late by at most one tick plus the worker's wake-up error. Periods are
+     * rounded up to whole ticks.
+     *
+     * Callbacks run outside the internal lock, either inline on the worker
+     * or on a ThreadPool (set_dispatch_pool()). A timer is never run
+     * concurrently with itself: a periodic timer is re-armed once its
+     * callback has returned, missed periods are skipped keeping the phase.
+     * Timers may be scheduled and cancelled from any thread, callbacks
+     * included, and before start().
+     */
+    class TimerService : public HiResTimedThread
+    {
+    public:
+        using Callback = InplaceFunction<void()>;
+
+        /** @brief Timer handle; 0 is never a valid timer. */
+        using TimerId = uint64_t;
+
+        static constexpr TimerId INVALID_TIMER = 0;
+
+        /**
+         * @brief Create the service (the worker is not started).
+         *
+         * @param tick_micro_sec wheel resolution in microseconds, at least 1
+         * @param max_timers maximum number of timers alive at the same time
+         */
+        explicit TimerService(int32_t tick_micro_sec = 1000, std::size_t max_timers = std::size_t{1} << 20);
+
+        /** @brief Stop the worker and wait for callbacks still running on the pool. */
+        ~TimerService() override;
+
+        /**
+         * @brief Run callbacks on @p pool instead of on the worker; nullptr restores inline dispatch.
+         *
+         * The pool must process its tasks (be running, or be stopped, which
+         * drains them) for the service to be destroyed.
+         */
+        void set_dispatch_pool (ThreadPool* pool);
+
+        /**
+         * @brief Run @p callback once after @p delay.
+         *
+         * @return the timer id, INVALID_TIMER when max_timers timers are alive
+         */
+        TimerId schedule_after (std::chrono::nanoseconds delay, Callback callback);
+
+        /**
+         * @brief Run @p callback every @p period, the first time after @p first_delay.
+         *
+         * @return the timer id, INVALID_TIMER when max_timers timers are alive
+         */
+        TimerId schedule_every (std::chrono::nanoseconds period, Callback callback,
+                                std::chrono::nanoseconds first_delay);
+
+        /** @brief Run @p callback every @p period, the first time one period from now. */
+        TimerId schedule_every (std::chrono::nanoseconds period, Callback callback);
+
+        /**
+         * @brief Cancel a timer.
+         *
+         * A callback already running is not interrupted but will not run
+         * again.
+         *
+         * @return true when the timer was alive
+         */
+        bool cancel (TimerId id);
+
+        /** @brief Number of timers alive (armed or running). */
+        std::size_t active_timers () const;
+
+        /** @brief Wheel resolution. */
+        std::chrono::nanoseconds tick () const;
+
+    protected:
+        /** @brief Advance the wheel to the current time and dispatch what expired. */
+        void run() override;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr uint32_t NIL = UINT32_MAX;
+        static constexpr unsigned LEVEL_BITS = 8;
+        static constexpr uint32_t LEVEL_SLOTS = 1U << LEVEL_BITS;
+        static constexpr unsigned LEVELS = 4;
+        static constexpr unsigned CHUNK_BITS = 10;
+
+        enum class NodeState : uint8_t
+        {
+            FREE,
+            ARMED,
+            FIRING,
+            FIRING_CANCELLED,
+        };
+
+        struct Node
+        {
+            Callback callback;
+            uint64_t expiry = 0;
+            uint64_t period = 0;
+            uint32_t prev = NIL;
+            uint32_t next = NIL;
+            uint32_t generation = 0;
+            /** @brief List holding the node: (level * 2 + lap parity) * LEVEL_SLOTS + slot. */
+            uint16_t list = 0;
+            NodeState state = NodeState::FREE;
+        };
+
+        Node& node (uint32_t index) const noexcept;
+
+        /** @brief Take a node from the free list (allocating a chunk if needed); NIL when full. */
+        uint32_t allocate_node ();
+
+        /** @brief Return @p index to the free list, invalidating its ids. */
+        void release_node (uint32_t index);
+
+        TimerId add_timer (std::chrono::nanoseconds delay, uint64_t period_ticks, Callback&& callback);
+
+        /**
+         * @brief Link @p index in the lowest level whose two laps cover its expiry.
+         *
+         * Each slot keeps one list per lap parity, so a level can hold the
+         * current lap and the next one without mixing them.
+         */
+        void insert (uint32_t index);
+
+        void unlink (uint32_t index);
+
+        /**
+         * @brief Move part of the next slot of @p level (>= 1) to the levels below.
+         *
+         * Spreads the slot over the ticks left before it becomes current,
+         * the last tick moves whatever remains.
+         */
+        void drain (unsigned level);
+
+        /** @brief Process tick current_tick_ and move to the next one. */
+        void advance ();
+
+        /** @brief Run the callback of a FIRING node, then re-arm or release it. */
+        void fire (uint32_t index);
+
+        /** @brief Post-callback bookkeeping of fire(), under the lock. */
+        void finish (uint32_t index);
+
+        /** @brief @p period in ticks, rounded up and at least one. */
+        uint64_t to_ticks (std::chrono::nanoseconds period) const;
+
+        const std::chrono::nanoseconds tick_;
+        const std::size_t max_nodes_;
+        const Clock::time_point origin_;
+
+        mutable std::mutex mutex_;
+        std::unique_ptr<std::unique_ptr<Node[]>[]> chunks_;
+        std::size_t allocated_nodes_;
+        uint32_t free_list_;
+        std::size_t active_;
+        std::array<uint32_t, LEVELS * 2 * LEVEL_SLOTS> wheel_;
+        std::array<uint32_t, LEVELS * 2 * LEVEL_SLOTS> wheel_count_;
+
+        /** @brief Next tick to process; timers expire at ticks >= current_tick_. */
+        uint64_t current_tick_;
+
+        /** @brief Nodes expired by the last advance, dispatched outside the lock. */
+        std::vector<uint32_t> expired_;
+
+        std::atomic<ThreadPool*> pool_;
+        std::atomic<uint32_t> pool_in_flight_;
+    };
+}
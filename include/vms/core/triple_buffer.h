@@ -0,0 +1,131 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Lock-free latest-value handoff between one writer and one reader.
+     *
+     * Three buffers rotate between the writer (back), the reader (front)
+     * and a shared middle slot. The writer fills its back buffer in place
+     * and publish() swaps it with the middle one; the reader's update()
+     * swaps the middle one with its front buffer when a new value is
+     * pending (dirty flag). Both sides work on their own buffer without
+     * copying and never wait for each other: an unread value is simply
+     * replaced by the next publish(), so the reader always gets the newest
+     * one and the writer never queues.
+     *
+     * Buffers are reused as they rotate, each keeps the contents of the
+     * last value written into it: large payloads (frames) can be
+     * allocated once by the constructor and rewritten in place.
+     *
+     * To hand results between Thread objects, publish() and then wake()
+     * the reader (notify() for a PollingThread); the reader calls update()
+     * from run().
+     *
+     * @tparam T buffer type
+     */
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        /** @brief Construct the three buffers, each from a copy of @p args. */
+        template <typename... Args>
+        explicit TripleBuffer(const Args&... args)
+            : buffers_{Buffer{T(args...)}, Buffer{T(args...)}, Buffer{T(args...)}}
+        {
+        }
+
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        /** @brief Writer: buffer to fill before the next publish(). */
+        T& write_buffer () noexcept
+        {
+            return buffers_[back_].value;
+        }
+
+        /**
+         * @brief Writer: make the write buffer the latest value.
+         *
+         * Never blocks. The writer gets a different buffer afterwards,
+         * holding an older value.
+         *
+         * @return true an unread value was replaced (the reader skipped it)
+         */
+        bool publish () noexcept
+        {
+            const uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | DIRTY), std::memory_order_acq_rel);
+            back_ = previous & INDEX_MASK;
+            return (previous & DIRTY) != 0;
+        }
+
+        /**
+         * @brief Reader: move to the latest published value, if any.
+         *
+         * @return true read_buffer() now holds a value not seen before
+         * @return false nothing was published since the last update()
+         */
+        bool update () noexcept
+        {
+            if ((middle_.load(std::memory_order_relaxed) & DIRTY) == 0)
+            {
+                return false;
+            }
+
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+            return true;
+        }
+
+        /** @brief Reader: latest value taken by update(); stable until the next update(). */
+        T& read_buffer () noexcept
+        {
+            return buffers_[front_].value;
+        }
+
+        /** @brief Reader: const access to read_buffer(). */
+        const T& read_buffer () const noexcept
+        {
+            return buffers_[front_].value;
+        }
+
+        /** @brief Whether a published value is waiting for update(); callable from any thread. */
+        bool has_update () const noexcept
+        {
+            return (middle_.load(std::memory_order_acquire) & DIRTY) != 0;
+        }
+
+    private:
+        /** @brief middle_ bits holding the buffer index. */
+        static constexpr uint8_t INDEX_MASK = 3u;
+
+        /** @brief middle_ bit set by publish(), cleared by update(). */
+        static constexpr uint8_t DIRTY = 4u;
+
+        struct alignas(cache_line_size) Buffer
+        {
+            T value;
+        };
+
+        Buffer buffers_[3];
+
+        /** @brief Index of the shared buffer plus DIRTY. */
+        alignas(cache_line_size) std::atomic<uint8_t> middle_{1};
+
+        /** @brief Writer-owned buffer index. */
+        alignas(cache_line_size) uint8_t back_ = 0;
+
+        /** @brief Reader-owned buffer index. */
+        alignas(cache_line_size) uint8_t front_ = 2;
+    };
+}
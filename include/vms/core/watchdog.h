@@ -0,0 +1,97 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <sys/types.h>
+#include <vector>
+
+#include <vms/core/thread_registry.h>
+#include <vms/core/thread_worker.h>
+
+namespace vms::core
+{
+    /** @brief Description of a run() iteration that exceeded its budget. */
+    struct StallReport
+    {
+        /** @brief Identity of the stalled Thread; compare only, never dereference. */
+        const Thread* thread = nullptr;
+
+        char name[Thread::MAX_NAME_LENGTH + 1] = {};
+        pid_t tid = 0;
+
+        /** @brief Index of the stalled iteration. */
+        uint64_t iteration = 0;
+
+        /** @brief Time spent in run() so far, measured at scan granularity. */
+        std::chrono::nanoseconds stuck_for{0};
+    };
+
+    /**
+     * @brief Worker reporting threads stuck inside run().
+     *
+     * Every scan period the watchdog walks the ThreadRegistry and compares
+     * each thread's loop heartbeat with the previous scan. A thread whose
+     * heartbeat shows it inside run() without progress for longer than its
+     * budget (Thread::set_watchdog_budget(), or the watchdog's default) is
+     * reported once per stalled iteration. Time spent in pre_run() and
+     * post_run(), where timed and event workers sleep, is never reported.
+     *
+     * The stuck time is measured from the first scan that saw the
+     * iteration, so it can be underestimated by up to one scan period.
+     */
+    class Watchdog : public TimedThread
+    {
+    public:
+        using Callback = std::function<void(const StallReport&)>;
+
+        /**
+         * @param callback invoked on the watchdog thread for every stall
+         * @param default_budget budget of threads that did not set their own
+         * @param scan_micro_sec scan period in microseconds
+         */
+        Watchdog(Callback callback, std::chrono::nanoseconds default_budget, int32_t scan_micro_sec = 10000);
+
+        ~Watchdog() override;
+
+        /** @brief Change the budget of threads without their own; takes effect at the next scan. */
+        void set_default_budget (std::chrono::nanoseconds budget);
+
+        /** @brief Budget of threads without their own. */
+        std::chrono::nanoseconds default_budget () const;
+
+        /** @brief Stalls reported since construction. */
+        uint64_t stall_count () const;
+
+    protected:
+        /** @brief Forget the observations of a previous run. */
+        bool init() override;
+
+        /** @brief Scan the registry once. */
+        void run() override;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /** @brief Last observation of one registry slot. */
+        struct Observation
+        {
+            uint64_t serial = 0;
+            uint64_t heartbeat = 0;
+            Clock::time_point since;
+            bool reported = false;
+        };
+
+        Callback callback_;
+        std::atomic<int64_t> default_budget_ns_;
+        std::atomic<uint64_t> stall_count_;
+        std::vector<Observation> observations_;
+    };
+}
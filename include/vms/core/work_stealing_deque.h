@@ -0,0 +1,146 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <vms/core/cpu.h>
+
+namespace vms::core
+{
+    /**
+     * @brief Bounded Chase-Lev work-stealing deque of pointers.
+     *
+     * The owner thread pushes and pops at the bottom (LIFO, cache friendly),
+     * any other thread steals from the top (FIFO). Memory orderings follow
+     * Le et al., "Correct and Efficient Work-Stealing for Weak Memory
+     * Models" (PPoPP 2013). The buffer does not grow: push() fails when
+     * full and the caller is expected to spill elsewhere.
+     *
+     * @tparam T pointee type, the deque stores @c T*
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+    public:
+        /**
+         * @brief Allocate the deque.
+         *
+         * @param capacity minimum number of elements, rounded up to a power of two (at least 2)
+         */
+        explicit WorkStealingDeque(std::size_t capacity)
+            : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+            , mask_(capacity_ - 1)
+            , buffer_(std::make_unique<std::atomic<T*>[]>(capacity_))
+        {
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /** @brief Owner: push at the bottom; false when full. */
+        bool push (T* item) noexcept
+        {
+            const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const int64_t top = top_.load(std::memory_order_acquire);
+
+            if (bottom - top >= static_cast<int64_t>(capacity_))
+            {
+                return false;
+            }
+
+            buffer_[static_cast<std::size_t>(bottom) & mask_].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /** @brief Owner: pop the most recently pushed element, nullptr when empty. */
+        T* pop () noexcept
+        {
+            const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            bottom_.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = top_.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = buffer_[static_cast<std::size_t>(bottom) & mask_].load(std::memory_order_relaxed);
+
+            if (top == bottom)
+            {
+                // Last element: race the thieves for it.
+                if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return item;
+        }
+
+        /** @brief Thief: take the oldest element, nullptr when empty or on a lost race. */
+        T* steal () noexcept
+        {
+            int64_t top = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            T* item = buffer_[static_cast<std::size_t>(top) & mask_].load(std::memory_order_relaxed);
+
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+
+            return item;
+        }
+
+        /** @brief Approximate number of elements, usable from any thread. */
+        std::size_t size_approx () const noexcept
+        {
+            const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const int64_t top = top_.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+        /** @brief Number of slots (power of two). */
+        std::size_t capacity () const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        /** @brief Thieves' end, CAS-ed by thieves and by the owner on the last element. */
+        alignas(cache_line_size) std::atomic<int64_t> top_{0};
+
+        /** @brief Owner's end. */
+        alignas(cache_line_size) std::atomic<int64_t> bottom_{0};
+
+        alignas(cache_line_size) const std::size_t capacity_;
+        const std::size_t mask_;
+        const std::unique_ptr<std::atomic<T*>[]> buffer_;
+    };
+}
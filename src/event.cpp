@@ -0,0 +1,190 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/event.h>
+#include <vms/core/futex.h>
+
+namespace
+{
+    /** @brief word_ bit set while the event is signalled. */
+    constexpr uint32_t SIGNALED = 1u;
+
+    /** @brief word_ increment of the interrupt generation (bits above SIGNALED). */
+    constexpr uint32_t GENERATION_STEP = 2u;
+}
+
+namespace vms::core
+{
+    // ------------------------------------------------------------------------ Event
+
+    Event::Event(EventMode mode /*= EventMode::MANUAL_RESET*/, bool initially_set /*= false*/)
+        : word_(initially_set ? SIGNALED : 0u)
+        , waiters_(0)
+        , mode_(mode)
+    {
+    }
+
+    void Event::set()
+    {
+        // Both sides are seq_cst: either a registered waiter is seen here, or
+        // the waiter sees SIGNALED before blocking.
+        const uint32_t previous = word_.fetch_or(SIGNALED);
+
+        if ((previous & SIGNALED) != 0 || waiters_.load() == 0)
+        {
+            return;
+        }
+
+        if (mode_ == EventMode::MANUAL_RESET)
+        {
+            futex_wake_all(word_);
+        }
+        else
+        {
+            futex_wake(word_);
+        }
+    }
+
+    void Event::reset()
+    {
+        word_.fetch_and(~SIGNALED);
+    }
+
+    bool Event::is_set() const
+    {
+        return (word_.load(std::memory_order_acquire) & SIGNALED) != 0;
+    }
+
+    EventMode Event::mode() const
+    {
+        return mode_;
+    }
+
+    void Event::wait()
+    {
+        wait_cancellable(std::chrono::steady_clock::time_point::max(), nullptr, 0);
+    }
+
+    bool Event::wait_until(std::chrono::steady_clock::time_point deadline)
+    {
+        return wait_cancellable(deadline, nullptr, 0);
+    }
+
+    bool Event::wait_for(std::chrono::steady_clock::duration timeout)
+    {
+        return wait_cancellable(std::chrono::steady_clock::now() + timeout, nullptr, 0);
+    }
+
+    bool Event::try_wait()
+    {
+        uint32_t current = word_.load(std::memory_order_acquire);
+
+        if (mode_ == EventMode::MANUAL_RESET)
+        {
+            return (current & SIGNALED) != 0;
+        }
+
+        while ((current & SIGNALED) != 0)
+        {
+            if (word_.compare_exchange_weak(current, current & ~SIGNALED, std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Event::wait_cancellable(std::chrono::steady_clock::time_point deadline,
+                                 const std::atomic<uint32_t>* cancel, uint32_t cancel_mask)
+    {
+        if (try_wait())
+        {
+            return true;
+        }
+
+        waiters_.fetch_add(1);
+
+        bool signaled = false;
+        bool elapsed = false;
+
+        while (!elapsed)
+        {
+            // Read before the checks: a set() or interrupt() after this
+            // point changes the word and makes the futex wait return.
+            const uint32_t observed = word_.load();
+
+            if (try_wait())
+            {
+                signaled = true;
+                break;
+            }
+
+            if (cancel != nullptr && (cancel->load() & cancel_mask) != 0)
+            {
+                break;
+            }
+
+            if ((observed & SIGNALED) != 0)
+            {
+                // Consumed by someone else in the meantime (AUTO_RESET).
+                continue;
+            }
+
+            if (deadline == std::chrono::steady_clock::time_point::max())
+            {
+                futex_wait(word_, observed);
+            }
+            else
+            {
+                elapsed = !futex_wait_until(word_, observed, deadline);
+            }
+        }
+
+        waiters_.fetch_sub(1);
+
+        // A set() racing with the timeout still counts.
+        return signaled || (elapsed && try_wait());
+    }
+
+    void Event::interrupt()
+    {
+        word_.fetch_add(GENERATION_STEP);
+        futex_wake_all(word_);
+    }
+
+    // -------------------------------------------------------------- BinarySemaphore
+
+    BinarySemaphore::BinarySemaphore(bool available /*= false*/)
+        : event_(EventMode::AUTO_RESET, available)
+    {
+    }
+
+    void BinarySemaphore::release()
+    {
+        event_.set();
+    }
+
+    void BinarySemaphore::acquire()
+    {
+        event_.wait();
+    }
+
+    bool BinarySemaphore::try_acquire()
+    {
+        return event_.try_wait();
+    }
+
+    bool BinarySemaphore::try_acquire_until(std::chrono::steady_clock::time_point deadline)
+    {
+        return event_.wait_until(deadline);
+    }
+
+    bool BinarySemaphore::try_acquire_for(std::chrono::steady_clock::duration timeout)
+    {
+        return event_.wait_for(timeout);
+    }
+}
@@ -0,0 +1,74 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/futex.h>
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex words must be plain 32-bit integers");
+
+namespace
+{
+    uint32_t* futex_address(std::atomic<uint32_t>& word) noexcept
+    {
+        return reinterpret_cast<uint32_t*>(&word);
+    }
+
+    long futex_call(uint32_t* address, int op, uint32_t value,
+                    const struct timespec* timeout, uint32_t bitset) noexcept
+    {
+        return syscall(SYS_futex, address, op | FUTEX_PRIVATE_FLAG, value, timeout, nullptr, bitset);
+    }
+}
+
+namespace vms::core
+{
+    void futex_wait(std::atomic<uint32_t>& word, uint32_t expected)
+    {
+        futex_call(futex_address(word), FUTEX_WAIT, expected, nullptr, 0);
+    }
+
+    bool futex_wait_until(std::atomic<uint32_t>& word, uint32_t expected,
+                          std::chrono::steady_clock::time_point deadline)
+    {
+        const auto since_epoch = deadline.time_since_epoch();
+
+        if (since_epoch.count() <= 0)
+        {
+            return false;
+        }
+
+        const auto secs = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+        const auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch - secs);
+
+        struct timespec abs_timeout;
+        abs_timeout.tv_sec = static_cast<time_t>(secs.count());
+        abs_timeout.tv_nsec = static_cast<long>(nsecs.count());
+
+        // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout.
+        const long rc = futex_call(futex_address(word), FUTEX_WAIT_BITSET, expected,
+                                   &abs_timeout, FUTEX_BITSET_MATCH_ANY);
+
+        return !(rc == -1 && errno == ETIMEDOUT);
+    }
+
+    int futex_wake(std::atomic<uint32_t>& word, int count /*= 1*/)
+    {
+        const long rc = futex_call(futex_address(word), FUTEX_WAKE, static_cast<uint32_t>(count), nullptr, 0);
+        return rc < 0 ? 0 : static_cast<int>(rc);
+    }
+
+    int futex_wake_all(std::atomic<uint32_t>& word)
+    {
+        return futex_wake(word, INT_MAX);
+    }
+}
@@ -0,0 +1,99 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/loop_statistics.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace vms::core
+{
+    // ------------------------------------------------------- LoopStatisticsSnapshot
+
+    double LoopStatisticsSnapshot::Summary::mean() const noexcept
+    {
+        return count == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(count);
+    }
+
+    uint64_t LoopStatisticsSnapshot::wakeup_percentile(double quantile) const noexcept
+    {
+        uint64_t samples = 0;
+        for (const uint64_t count : wakeup_histogram)
+        {
+            samples += count;
+        }
+
+        if (samples == 0)
+        {
+            return 0;
+        }
+
+        const double clamped = std::clamp(quantile, 0.0, 1.0);
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(samples))));
+
+        uint64_t seen = 0;
+        for (size_t idx = 0; idx < wakeup_histogram.size(); ++idx)
+        {
+            seen += wakeup_histogram[idx];
+
+            if (seen >= rank)
+            {
+                return LogLinearBuckets::upper_bound(idx);
+            }
+        }
+
+        return LogLinearBuckets::upper_bound(wakeup_histogram.size() - 1);
+    }
+
+    // --------------------------------------------------------------- LoopStatistics
+
+    void LoopStatistics::Summary::clear() noexcept
+    {
+        count.store(0, std::memory_order_relaxed);
+        min.store(UINT64_MAX, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+    }
+
+    LoopStatisticsSnapshot::Summary LoopStatistics::Summary::load() const noexcept
+    {
+        LoopStatisticsSnapshot::Summary summary;
+        summary.count = count.load(std::memory_order_relaxed);
+        summary.total = total.load(std::memory_order_relaxed);
+        summary.max = max.load(std::memory_order_relaxed);
+        summary.min = (summary.count == 0) ? 0 : min.load(std::memory_order_relaxed);
+        return summary;
+    }
+
+    void LoopStatistics::clear() noexcept
+    {
+        wakeup_latency_.clear();
+        run_duration_.clear();
+        period_.clear();
+
+        for (auto& bucket : wakeup_histogram_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+
+        reset_requested_.store(false, std::memory_order_relaxed);
+    }
+
+    LoopStatisticsSnapshot LoopStatistics::snapshot() const noexcept
+    {
+        LoopStatisticsSnapshot snap;
+        snap.wakeup_latency = wakeup_latency_.load();
+        snap.run_duration = run_duration_.load();
+        snap.period = period_.load();
+
+        for (size_t idx = 0; idx < wakeup_histogram_.size(); ++idx)
+        {
+            snap.wakeup_histogram[idx] = wakeup_histogram_[idx].load(std::memory_order_relaxed);
+        }
+
+        return snap;
+    }
+}
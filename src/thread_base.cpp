@@ -5,76 +5,383 @@
 */
 
 #include <vms/core/thread_base.h>
+#include <vms/core/event.h>
+#include <vms/core/futex.h>
+#include <vms/core/thread_registry.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iterator>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <utility>
 
+namespace
+{
+    /**
+     * @brief Layout of the kernel's struct sched_attr (SCHED_ATTR_SIZE_VER0).
+     *
+     * glibc wraps neither sched_setattr nor sched_getattr, the struct is
+     * mirrored here to avoid pulling linux/sched/types.h next to sched.h.
+     */
+    struct SchedAttr
+    {
+        uint32_t size;
+        uint32_t sched_policy;
+        uint64_t sched_flags;
+        int32_t sched_nice;
+        uint32_t sched_priority;
+        uint64_t sched_runtime;
+        uint64_t sched_deadline;
+        uint64_t sched_period;
+    };
+
+    /** @brief sched_setattr() on @p tid (0 = caller); returns 0 or errno. */
+    int set_thread_scheduling(pid_t tid, const vms::core::ThreadScheduling& params)
+    {
+        SchedAttr attr{};
+        attr.size = sizeof(SchedAttr);
+        attr.sched_policy = static_cast<uint32_t>(params.policy);
+        attr.sched_nice = params.nice;
+        attr.sched_priority = static_cast<uint32_t>(params.priority);
+
+        if (params.policy == vms::core::ThreadSchedulingPolicy::DEADLINE)
+        {
+            attr.sched_runtime = static_cast<uint64_t>(params.runtime.count());
+            attr.sched_deadline = static_cast<uint64_t>(params.deadline.count());
+            attr.sched_period = static_cast<uint64_t>(params.period.count());
+        }
+
+        if (syscall(SYS_sched_setattr, tid, &attr, 0u) == -1)
+        {
+            return errno;
+        }
+
+        return 0;
+    }
+
+    /** @brief Poll timeout of wait_readable() when wake() cannot signal the eventfd. */
+    constexpr int wake_poll_slice_ms = 10;
+
+    /** @brief CPU @p tid last ran on, from /proc/self/task/<tid>/stat; -1 on failure. */
+    int read_task_cpu(pid_t tid)
+    {
+        char path[64];
+        std::snprintf(path, sizeof(path), "/proc/self/task/%d/stat", static_cast<int>(tid));
+
+        const int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            return -1;
+        }
+
+        char buffer[512];
+        const ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+        close(fd);
+
+        if (length <= 0)
+        {
+            return -1;
+        }
+
+        buffer[length] = '\0';
+
+        // The comm field may contain spaces: count from its closing parenthesis.
+        const char* field = std::strrchr(buffer, ')');
+
+        // "processor" is field 39, the 37th one after comm.
+        for (int idx = 0; field != nullptr && idx < 37; ++idx)
+        {
+            field = std::strchr(field + 1, ' ');
+        }
+
+        if (field == nullptr)
+        {
+            return -1;
+        }
+
+        return static_cast<int>(std::strtol(field + 1, nullptr, 10));
+    }
+
+    /** @brief sched_getattr() on @p tid; returns 0 or errno. */
+    int get_thread_scheduling(pid_t tid, vms::core::ThreadScheduling& params)
+    {
+        SchedAttr attr{};
+
+        if (syscall(SYS_sched_getattr, tid, &attr, static_cast<unsigned>(sizeof(SchedAttr)), 0u) == -1)
+        {
+            return errno;
+        }
+
+        params.policy = static_cast<vms::core::ThreadSchedulingPolicy>(attr.sched_policy);
+        params.priority = static_cast<int>(attr.sched_priority);
+        params.nice = attr.sched_nice;
+        params.runtime = std::chrono::nanoseconds(attr.sched_runtime);
+        params.deadline = std::chrono::nanoseconds(attr.sched_deadline);
+        params.period = std::chrono::nanoseconds(attr.sched_period);
+
+        return 0;
+    }
+}
+
 namespace vms::core
 {
     // Base Thread Implementation
 
     Thread::Thread()
-        : stop_flag_(true)
-    {}
+        : waited_event_(nullptr)
+        , wake_fd_(-1)
+        , wake_fd_error_(0)
+        , has_affinity_(false)
+        , last_cpu_(-1)
+        , affinity_error_(0)
+        , scheduling_{}
+        , has_scheduling_(false)
+        , scheduling_error_(0)
+        , tid_(0)
+        , name_{}
+        , registry_slot_(nullptr)
+        , watchdog_budget_(0)
+    {
+        CPU_ZERO(&affinity_mask_);
+    }
 
     Thread::~Thread()
     {
         stop(true);
+
+        const int wake_fd = wake_fd_.load(std::memory_order_relaxed);
+        if (wake_fd >= 0)
+        {
+            close(wake_fd);
+        }
     }
 
     bool Thread::start ()
     {
-        std::lock_guard<std::mutex> lock(state_mutex_);
+        return start_worker([this]
+        {
+            registry_slot_ = ThreadRegistry::acquire(this, name_, watchdog_budget_);
 
-        if (thread_.joinable())
+            try
+            {
+                return std::thread(&Thread::loop, this, registry_slot_);
+            }
+            catch (...)
+            {
+                ThreadRegistry::release(std::exchange(registry_slot_, nullptr));
+                throw;
+            }
+        });
+    }
+
+    void Thread::stop (bool wait_join /*= true*/)
+    {
+        request_stop();
+
+        if (wait_join)
         {
-            return false;
+            join_worker();
         }
+    }
+
+    Thread::JoinHandle Thread::request_stop()
+    {
+        ThreadCore::request_stop();
+        wake();
+
+        return JoinHandle(this);
+    }
 
-        stop_flag_.store(false, std::memory_order_release);
+    Thread::JoinHandle Thread::join_handle() const
+    {
+        return JoinHandle(this);
+    }
 
-        try
+    void Thread::stop_all(std::span<Thread* const> threads)
+    {
+        for (Thread* thread : threads)
         {
-            thread_ = std::thread(&Thread::loop, this);
+            thread->request_stop();
         }
-        catch (...)
+
+        for (Thread* thread : threads)
         {
-            stop_flag_.store(true, std::memory_order_release);
-            throw;
+            thread->join_handle().wait();
         }
 
-        return true;
+        // Every loop has exited: the joins below return immediately.
+        for (Thread* thread : threads)
+        {
+            thread->stop(true);
+        }
     }
 
-    void Thread::stop (bool wait_join /*= true*/)
+    ThreadState Thread::state() const
+    {
+        return ThreadCore::state();
+    }
+
+    void Thread::wake()
     {
-        std::thread join_handle;
-        bool should_join = wait_join;
+        const uint32_t previous = ThreadCore::wake();
 
+        if ((previous & POLLING) != 0)
         {
-            std::lock_guard<std::mutex> lock(state_mutex_);
+            // Without an eventfd the poller re-checks wake_word_ on its own, see wait_readable().
+            const int wake_fd = wake_fd_.load(std::memory_order_acquire);
 
-            stop_flag_.store(true, std::memory_order_release);
+            if (wake_fd >= 0)
+            {
+                const uint64_t one = 1;
+                ssize_t written = 0;
 
-            if (!thread_.joinable())
+                do
+                {
+                    written = write(wake_fd, &one, sizeof(one));
+                }
+                while (written < 0 && errno == EINTR);
+
+                // EAGAIN: the counter is saturated, the poller is already due to wake up.
+                if (written < 0 && errno != EAGAIN)
+                {
+                    wake_fd_error_.store(errno, std::memory_order_relaxed);
+                }
+            }
+        }
+        else if ((previous & (EVENT_WAITING | WAKE_PENDING)) == EVENT_WAITING)
+        {
+            // Only the wake() that set WAKE_PENDING gets here; wait_event()
+            // does not return (and the Event may not die) before INTERRUPT_DONE.
+            waited_event_.load()->interrupt();
+            wake_word_.fetch_or(INTERRUPT_DONE);
+        }
+    }
+
+    bool Thread::sleep_until(std::chrono::steady_clock::time_point deadline)
+    {
+        return ThreadCore::sleep_until(deadline);
+    }
+
+    bool Thread::sleep_for(std::chrono::steady_clock::duration duration)
+    {
+        return sleep_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    void Thread::wait_for_wake()
+    {
+        sleep_until(std::chrono::steady_clock::time_point::max());
+    }
+
+    bool Thread::wait_readable(int fd)
+    {
+        int wake_fd = wake_fd_.load(std::memory_order_relaxed);
+
+        if (wake_fd < 0)
+        {
+            wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            wake_fd_.store(wake_fd, std::memory_order_release);
+        }
+
+        // No usable wake channel: poll in slices so wake() and stop() are
+        // still noticed through wake_word_.
+        const int timeout_ms = (wake_fd < 0 || wake_fd_error_.load(std::memory_order_relaxed) != 0)
+            ? wake_poll_slice_ms
+            : -1;
+
+        struct pollfd fds[2];
+        fds[0] = {fd, POLLIN, 0};
+        fds[1] = {wake_fd, POLLIN, 0};
+
+        const nfds_t nfds = wake_fd < 0 ? 1 : 2;
+        uint32_t expected = 0;
+
+        if (stop_flag_.load(std::memory_order_acquire)
+            || !wake_word_.compare_exchange_strong(expected, POLLING))
+        {
+            wake_word_.store(0);
+            return false;
+        }
+
+        bool readable = false;
+
+        while (!readable && wake_word_.load() == POLLING)
+        {
+            if (poll(fds, nfds, timeout_ms) < 0)
             {
-                return;
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                break;
             }
 
-            if (thread_.get_id() == std::this_thread::get_id())
+            if (fds[1].revents != 0)
             {
-                should_join = false;
+                // Drain: a late write() may belong to an already consumed wake().
+                uint64_t count = 0;
+                const ssize_t drained = read(wake_fd, &count, sizeof(count));
+                static_cast<void>(drained);
             }
 
-            if (should_join)
+            readable = (fds[0].revents != 0);
+        }
+
+        return (wake_word_.exchange(0) & WAKE_PENDING) == 0 && readable;
+    }
+
+    bool Thread::wait_event(Event& event, std::chrono::steady_clock::time_point deadline)
+    {
+        if (event.try_wait())
+        {
+            return true;
+        }
+
+        waited_event_.store(&event);
+        uint32_t expected = 0;
+
+        if (stop_flag_.load(std::memory_order_acquire)
+            || !wake_word_.compare_exchange_strong(expected, EVENT_WAITING))
+        {
+            wake_word_.store(0);
+            waited_event_.store(nullptr);
+            return false;
+        }
+
+        const bool signaled = event.wait_cancellable(deadline, &wake_word_, WAKE_PENDING);
+
+        if ((wake_word_.fetch_and(~EVENT_WAITING) & WAKE_PENDING) != 0)
+        {
+            // A wake() saw EVENT_WAITING: let it finish with the Event first.
+            while ((wake_word_.load() & INTERRUPT_DONE) == 0)
             {
-                join_handle = std::move(thread_);
+                std::this_thread::yield();
             }
         }
 
-        if (should_join && join_handle.joinable())
+        const bool interrupted = (wake_word_.exchange(0) & WAKE_PENDING) != 0;
+        waited_event_.store(nullptr);
+
+        if (signaled && interrupted)
         {
-            join_handle.join();
+            // The event was consumed: keep the wake-up for the next wait instead.
+            wake_word_.store(WAKE_PENDING);
         }
+
+        return signaled;
+    }
+
+    bool Thread::wait_acquire(BinarySemaphore& semaphore, std::chrono::steady_clock::time_point deadline)
+    {
+        return wait_event(semaphore.event_, deadline);
     }
 
     bool Thread::init()
@@ -94,22 +401,327 @@ namespace vms::core
     {
     }
 
-    void Thread::loop()
+    bool Thread::set_affinity(const cpu_set_t& mask)
+    {
+        if (CPU_COUNT(&mask) == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        affinity_mask_ = mask;
+        has_affinity_ = true;
+
+        if (!thread_.joinable())
+        {
+            return true;
+        }
+
+        const int rc = pthread_setaffinity_np(thread_.native_handle(), sizeof(cpu_set_t), &affinity_mask_);
+        affinity_error_.store(rc, std::memory_order_relaxed);
+
+        return rc == 0;
+    }
+
+    bool Thread::set_affinity(int cpu)
+    {
+        if (cpu < 0 || cpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+
+        return set_affinity(mask);
+    }
+
+    void Thread::clear_affinity()
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        CPU_ZERO(&affinity_mask_);
+        has_affinity_ = false;
+    }
+
+    bool Thread::get_affinity(cpu_set_t& mask) const
     {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        if (thread_.joinable())
+        {
+            // pthread_getaffinity_np() is not const-qualified on the handle.
+            auto handle = const_cast<std::thread&>(thread_).native_handle();
+            return pthread_getaffinity_np(handle, sizeof(cpu_set_t), &mask) == 0;
+        }
+
+        if (!has_affinity_)
+        {
+            return false;
+        }
+
+        mask = affinity_mask_;
+        return true;
+    }
+
+    int Thread::last_cpu() const
+    {
+        // Sampled on demand: the loop itself never pays for it.
+        const pid_t tid = tid_.load(std::memory_order_acquire);
+
+        if (tid != 0)
+        {
+            const int cpu = read_task_cpu(tid);
+
+            if (cpu >= 0)
+            {
+                return cpu;
+            }
+        }
+
+        return last_cpu_.load(std::memory_order_relaxed);
+    }
+
+    int Thread::affinity_error() const
+    {
+        return affinity_error_.load(std::memory_order_relaxed);
+    }
+
+    void Thread::apply_affinity()
+    {
+        cpu_set_t mask;
+        bool has_mask = false;
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            mask = affinity_mask_;
+            has_mask = has_affinity_;
+        }
+
+        if (has_mask)
+        {
+            const int rc = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &mask);
+            affinity_error_.store(rc, std::memory_order_relaxed);
+        }
+
+        last_cpu_.store(sched_getcpu(), std::memory_order_relaxed);
+    }
+
+    bool Thread::set_scheduling(const ThreadScheduling& params)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        scheduling_ = params;
+        has_scheduling_ = true;
+
+        // A zero tid means the loop has not reached apply_scheduling() yet and
+        // will pick the new request up by itself.
+        const pid_t tid = tid_.load(std::memory_order_acquire);
+
+        if (!thread_.joinable() || tid == 0)
+        {
+            return true;
+        }
+
+        const int rc = set_thread_scheduling(tid, scheduling_);
+        scheduling_error_.store(rc, std::memory_order_relaxed);
+
+        return rc == 0;
+    }
+
+    void Thread::clear_scheduling()
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        scheduling_ = ThreadScheduling{};
+        has_scheduling_ = false;
+    }
+
+    bool Thread::get_scheduling(ThreadScheduling& params) const
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        const pid_t tid = tid_.load(std::memory_order_acquire);
+
+        if (thread_.joinable() && tid != 0)
+        {
+            return get_thread_scheduling(tid, params) == 0;
+        }
+
+        if (!has_scheduling_)
+        {
+            return false;
+        }
+
+        params = scheduling_;
+        return true;
+    }
+
+    int Thread::scheduling_error() const
+    {
+        return scheduling_error_.load(std::memory_order_relaxed);
+    }
+
+    void Thread::apply_scheduling()
+    {
+        ThreadScheduling params;
+        bool has_params = false;
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            params = scheduling_;
+            has_params = has_scheduling_;
+        }
+
+        if (has_params)
+        {
+            scheduling_error_.store(set_thread_scheduling(0, params), std::memory_order_relaxed);
+        }
+    }
+
+    void Thread::loop(ThreadRegistrySlot* slot)
+    {
+        // Published before reading the scheduling request, see set_scheduling().
+        const pid_t tid = gettid();
+        tid_.store(tid, std::memory_order_release);
+        slot->tid.store(tid, std::memory_order_relaxed);
+
+        clockid_t cpu_clock;
+        if (pthread_getcpuclockid(pthread_self(), &cpu_clock) == 0)
+        {
+            slot->cpu_clock.store(cpu_clock, std::memory_order_relaxed);
+            slot->has_cpu_clock.store(true, std::memory_order_relaxed);
+        }
+
+        apply_name();
+
+        // Affinity first: the kernel refuses to narrow the mask of a DEADLINE task.
+        apply_affinity();
+        apply_scheduling();
+
         if (!init())
         {
             stop_flag_.store(true, std::memory_order_release);
+            leave_registry(slot);
+            tid_.store(0, std::memory_order_release);
+
+            // Last: start() may reap the thread as soon as it is visible.
+            set_state(ThreadState::FAILED_INIT);
             return;
         }
-        
+
+        transition(ThreadState::STARTING, ThreadState::RUNNING);
+        slot->state.store(ThreadState::RUNNING, std::memory_order_relaxed);
+        uint64_t heartbeat = 0;
+
         while  (!stop_flag_.load(std::memory_order_acquire))
         {
             pre_run();
+
+            // pre_run() may have been waiting (EventThread, TimedThread): a
+            // stop requested meanwhile must not be followed by one more run().
+            if (stop_flag_.load(std::memory_order_acquire))
+            {
+                break;
+            }
+
+            // Heartbeat for the Watchdog: odd while inside run(), bumped when it returns.
+            slot->heartbeat.store(heartbeat | 1, std::memory_order_relaxed);
             run();
+            heartbeat += 2;
+            slot->heartbeat.store(heartbeat, std::memory_order_relaxed);
+
             post_run();
         }
 
+        last_cpu_.store(sched_getcpu(), std::memory_order_relaxed);
+
+        set_state(ThreadState::STOPPING);
+        slot->state.store(ThreadState::STOPPING, std::memory_order_relaxed);
         uninit();
+
+        leave_registry(slot);
+        tid_.store(0, std::memory_order_release);
+        set_state(ThreadState::STOPPED);
+    }
+
+    void Thread::leave_registry(ThreadRegistrySlot* slot)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        ThreadRegistry::release(slot);
+
+        if (registry_slot_ == slot)
+        {
+            registry_slot_ = nullptr;
+        }
+    }
+
+    bool Thread::set_name(std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        const std::size_t length = std::min(name.size(), MAX_NAME_LENGTH);
+        name.copy(name_, length);
+        name_[length] = '\0';
+
+        if (registry_slot_ != nullptr)
+        {
+            ThreadRegistry::store_name(registry_slot_, name_);
+        }
+
+        if (!thread_.joinable() || tid_.load(std::memory_order_acquire) == 0 || length == 0)
+        {
+            return true;
+        }
+
+        return pthread_setname_np(thread_.native_handle(), name_) == 0;
+    }
+
+    std::string Thread::name() const
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        return std::string(name_);
+    }
+
+    void Thread::set_watchdog_budget(std::chrono::nanoseconds budget)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        watchdog_budget_ = budget;
+
+        if (registry_slot_ != nullptr)
+        {
+            registry_slot_->watchdog_budget_ns.store(budget.count(), std::memory_order_relaxed);
+        }
+    }
+
+    std::chrono::nanoseconds Thread::watchdog_budget() const
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        return watchdog_budget_;
+    }
+
+    pid_t Thread::tid() const
+    {
+        return tid_.load(std::memory_order_acquire);
+    }
+
+    void Thread::apply_name()
+    {
+        char name[MAX_NAME_LENGTH + 1];
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            std::copy(std::begin(name_), std::end(name_), std::begin(name));
+        }
+
+        if (name[0] != '\0')
+        {
+            pthread_setname_np(pthread_self(), name);
+        }
     }
 
     bool Thread::set_process_priority(int priority, ThreadSchedulingPolicy policy)
@@ -126,4 +738,33 @@ namespace vms::core
         return true;
     }
 
+    Thread::JoinHandle::JoinHandle(const detail::ThreadCore* thread) noexcept
+        : thread_(thread)
+    {
+    }
+
+    bool Thread::JoinHandle::valid() const noexcept
+    {
+        return thread_ != nullptr;
+    }
+
+    bool Thread::JoinHandle::done() const noexcept
+    {
+        return detail::ThreadCore::is_exited(thread_->state());
+    }
+
+    void Thread::JoinHandle::wait() const
+    {
+        thread_->wait_exit(std::chrono::steady_clock::time_point::max());
+    }
+
+    bool Thread::JoinHandle::wait_until(std::chrono::steady_clock::time_point deadline) const
+    {
+        return thread_->wait_exit(deadline);
+    }
+
+    bool Thread::JoinHandle::wait_for(std::chrono::steady_clock::duration timeout) const
+    {
+        return thread_->wait_exit(std::chrono::steady_clock::now() + timeout);
+    }
 }
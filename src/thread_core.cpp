@@ -0,0 +1,159 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/thread_core.h>
+#include <vms/core/futex.h>
+
+#include <utility>
+
+namespace vms::core::detail
+{
+    ThreadCore::ThreadCore()
+        : stop_flag_(true)
+        , state_word_(static_cast<uint32_t>(ThreadState::IDLE))
+        , wake_word_(0)
+    {
+    }
+
+    bool ThreadCore::is_exited(ThreadState state) noexcept
+    {
+        return state == ThreadState::IDLE || state == ThreadState::STOPPED || state == ThreadState::FAILED_INIT;
+    }
+
+    ThreadState ThreadCore::state() const
+    {
+        return static_cast<ThreadState>(state_word_.load(std::memory_order_acquire) & STATE_MASK);
+    }
+
+    bool ThreadCore::wait_exit(std::chrono::steady_clock::time_point deadline) const
+    {
+        for (;;)
+        {
+            uint32_t current = state_word_.load(std::memory_order_acquire);
+
+            if (is_exited(static_cast<ThreadState>(current & STATE_MASK)))
+            {
+                return true;
+            }
+
+            if ((current & STATE_WAITERS) == 0 &&
+                !state_word_.compare_exchange_weak(current, current | STATE_WAITERS, std::memory_order_acq_rel))
+            {
+                continue;
+            }
+
+            if (deadline == std::chrono::steady_clock::time_point::max())
+            {
+                futex_wait(state_word_, current | STATE_WAITERS);
+            }
+            else if (!futex_wait_until(state_word_, current | STATE_WAITERS, deadline))
+            {
+                return is_exited(state());
+            }
+        }
+    }
+
+    void ThreadCore::request_stop()
+    {
+        stop_flag_.store(true, std::memory_order_release);
+
+        if (!transition(ThreadState::RUNNING, ThreadState::STOPPING))
+        {
+            transition(ThreadState::STARTING, ThreadState::STOPPING);
+        }
+    }
+
+    void ThreadCore::join_worker()
+    {
+        std::thread join_handle;
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+
+            if (!thread_.joinable() || thread_.get_id() == std::this_thread::get_id())
+            {
+                return;
+            }
+
+            join_handle = std::move(thread_);
+        }
+
+        join_handle.join();
+    }
+
+    uint32_t ThreadCore::wake()
+    {
+        // Only pay for the syscall when the worker is actually blocked.
+        const uint32_t previous = wake_word_.fetch_or(WAKE_PENDING);
+
+        if ((previous & SLEEPING) != 0)
+        {
+            futex_wake(wake_word_);
+        }
+
+        return previous;
+    }
+
+    bool ThreadCore::sleep_until(std::chrono::steady_clock::time_point deadline)
+    {
+        uint32_t expected = 0;
+
+        if (stop_flag_.load(std::memory_order_acquire)
+            || !wake_word_.compare_exchange_strong(expected, SLEEPING))
+        {
+            wake_word_.store(0);
+            return false;
+        }
+
+        bool elapsed = false;
+
+        while (!elapsed && wake_word_.load() == SLEEPING)
+        {
+            if (deadline == std::chrono::steady_clock::time_point::max())
+            {
+                futex_wait(wake_word_, SLEEPING);
+            }
+            else
+            {
+                elapsed = !futex_wait_until(wake_word_, SLEEPING, deadline);
+            }
+        }
+
+        // A wake() racing with the timeout still counts as an interruption.
+        return (wake_word_.exchange(0) & WAKE_PENDING) == 0;
+    }
+
+    void ThreadCore::set_state(ThreadState state)
+    {
+        const uint32_t previous = state_word_.exchange(static_cast<uint32_t>(state), std::memory_order_acq_rel);
+
+        if ((previous & STATE_WAITERS) != 0)
+        {
+            futex_wake_all(state_word_);
+        }
+    }
+
+    bool ThreadCore::transition(ThreadState from, ThreadState to)
+    {
+        uint32_t current = state_word_.load(std::memory_order_acquire);
+
+        while ((current & STATE_MASK) == static_cast<uint32_t>(from))
+        {
+            // Waiters are woken on every change and re-register if needed.
+            if (state_word_.compare_exchange_weak(current, static_cast<uint32_t>(to), std::memory_order_acq_rel))
+            {
+                if ((current & STATE_WAITERS) != 0)
+                {
+                    futex_wake_all(state_word_);
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,291 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/thread_pool.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+    /** @brief Empty polls spent spinning before a worker starts yielding. */
+    constexpr uint32_t spin_rounds = 64;
+
+    /** @brief Further empty polls spent yielding before a worker parks. */
+    constexpr uint32_t yield_rounds = 8;
+}
+
+namespace vms::core
+{
+    // --------------------------------------------------------------------- ThreadPool::Worker
+
+    class ThreadPool::Worker final : public Thread
+    {
+    public:
+        Worker(ThreadPool& pool, std::size_t index, std::size_t capacity)
+            : pool_(pool)
+            , index_(index)
+            , deque_(capacity)
+        {
+        }
+
+        /** @brief Worker of the calling thread, nullptr outside any pool. */
+        static thread_local Worker* current;
+
+        ThreadPool& pool_;
+        const std::size_t index_;
+        WorkStealingDeque<detail::TaskNode> deque_;
+
+    protected:
+        bool init() override
+        {
+            current = this;
+            return true;
+        }
+
+        void uninit() override
+        {
+            current = nullptr;
+        }
+
+        void run() override
+        {
+            if (detail::TaskNode* task = pool_.find_task(*this))
+            {
+                idle_rounds_ = 0;
+                task->execute();
+                return;
+            }
+
+            ++idle_rounds_;
+
+            if (idle_rounds_ <= spin_rounds)
+            {
+                cpu_relax();
+            }
+            else if (idle_rounds_ <= spin_rounds + yield_rounds)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                pool_.park();
+                idle_rounds_ = 0;
+            }
+        }
+
+    private:
+        uint32_t idle_rounds_ = 0;
+    };
+
+    thread_local ThreadPool::Worker* ThreadPool::Worker::current = nullptr;
+
+    // --------------------------------------------------------------------- ThreadPool
+
+    ThreadPool::ThreadPool(std::size_t worker_count, std::size_t queue_capacity)
+        : injection_(queue_capacity)
+        , running_(false)
+        , epoch_(0)
+        , parked_(0)
+    {
+        const std::size_t count = std::max<std::size_t>(worker_count, 1);
+        workers_.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            workers_.push_back(std::make_unique<Worker>(*this, i, queue_capacity));
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        stop();
+    }
+
+    bool ThreadPool::start()
+    {
+        if (running_.exchange(true, std::memory_order_seq_cst))
+        {
+            return false;
+        }
+
+        for (auto& worker : workers_)
+        {
+            if (!worker->start())
+            {
+                stop();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ThreadPool::stop()
+    {
+        running_.store(false, std::memory_order_seq_cst);
+
+        for (auto& worker : workers_)
+        {
+            worker->stop(false);
+        }
+
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        futex_wake_all(epoch_);
+
+        for (auto& worker : workers_)
+        {
+            worker->stop(true);
+        }
+
+        // Run what is left so that no TaskFuture stays pending forever; tasks
+        // submitted by these tasks land in the injection queue and are drained too.
+        detail::TaskNode* task = nullptr;
+        bool drained = false;
+
+        while (!drained)
+        {
+            drained = true;
+
+            while (injection_.try_pop(task))
+            {
+                task->execute();
+                drained = false;
+            }
+
+            for (auto& worker : workers_)
+            {
+                while ((task = worker->deque_.pop()) != nullptr)
+                {
+                    task->execute();
+                    drained = false;
+                }
+            }
+        }
+    }
+
+    std::size_t ThreadPool::size() const noexcept
+    {
+        return workers_.size();
+    }
+
+    Thread& ThreadPool::worker(std::size_t index)
+    {
+        return *workers_.at(index);
+    }
+
+    bool ThreadPool::on_worker() noexcept
+    {
+        return Worker::current != nullptr;
+    }
+
+    void ThreadPool::help_or_yield() noexcept
+    {
+        Worker* self = Worker::current;
+
+        if (self != nullptr)
+        {
+            if (detail::TaskNode* task = self->pool_.find_task(*self))
+            {
+                task->execute();
+                return;
+            }
+        }
+
+        std::this_thread::yield();
+    }
+
+    void ThreadPool::enqueue(detail::TaskNode* task)
+    {
+        Worker* self = Worker::current;
+
+        if (self != nullptr && &self->pool_ == this && self->deque_.push(task))
+        {
+            wake_one();
+            return;
+        }
+
+        if (injection_.try_push(task))
+        {
+            wake_one();
+            return;
+        }
+
+        // Every queue is full: apply back-pressure by running the task here.
+        task->execute();
+    }
+
+    detail::TaskNode* ThreadPool::find_task(Worker& self)
+    {
+        if (detail::TaskNode* task = self.deque_.pop())
+        {
+            return task;
+        }
+
+        detail::TaskNode* task = nullptr;
+
+        if (injection_.try_pop(task))
+        {
+            return task;
+        }
+
+        const std::size_t count = workers_.size();
+
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            Worker& victim = *workers_[(self.index_ + i) % count];
+
+            if ((task = victim.deque_.steal()) != nullptr)
+            {
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void ThreadPool::park()
+    {
+        const uint32_t epoch = epoch_.load(std::memory_order_seq_cst);
+        parked_.fetch_add(1, std::memory_order_seq_cst);
+
+        // Pairs with the fence in wake_one(): has_work() reads the queues with
+        // relaxed loads, which could otherwise be satisfied before the parked_
+        // store is visible (ARM without LSE). With both fences, either this
+        // re-check sees the task or the producer sees parked_ != 0 and bumps
+        // epoch_, failing the futex_wait() below.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (running_.load(std::memory_order_seq_cst) && !has_work())
+        {
+            futex_wait(epoch_, epoch);
+        }
+
+        parked_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void ThreadPool::wake_one()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (parked_.load(std::memory_order_seq_cst) != 0)
+        {
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+            futex_wake(epoch_, 1);
+        }
+    }
+
+    bool ThreadPool::has_work() const
+    {
+        if (injection_.size_approx() != 0)
+        {
+            return true;
+        }
+
+        return std::any_of(workers_.begin(), workers_.end(),
+                           [](const auto& worker) { return worker->deque_.size_approx() != 0; });
+    }
+}
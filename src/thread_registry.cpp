@@ -0,0 +1,220 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/thread_registry.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    using vms::core::ThreadRegistry;
+    using vms::core::ThreadRegistrySlot;
+
+    std::array<ThreadRegistrySlot, ThreadRegistry::CAPACITY> registry_slots;
+
+    /** @brief Written by threads that found the table full, never reported. */
+    ThreadRegistrySlot overflow_slot;
+
+    std::atomic<std::size_t> next_slot{0};
+    std::atomic<uint64_t> next_serial{0};
+    std::atomic<uint64_t> dropped_registrations{0};
+
+    /** @brief Value following @p key in a /proc status buffer, 0 when missing. */
+    uint64_t status_field(const char* status, const char* key)
+    {
+        const char* line = std::strstr(status, key);
+
+        if (line == nullptr)
+        {
+            return 0;
+        }
+
+        return std::strtoull(line + std::strlen(key), nullptr, 10);
+    }
+
+    /** @brief Read the context switch counters of @p tid from /proc. */
+    void read_context_switches(pid_t tid, vms::core::ThreadInfo& info)
+    {
+        char path[64];
+        std::snprintf(path, sizeof(path), "/proc/self/task/%d/status", static_cast<int>(tid));
+
+        const int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            return;
+        }
+
+        char status[4096];
+        const ssize_t length = read(fd, status, sizeof(status) - 1);
+        close(fd);
+
+        if (length <= 0)
+        {
+            return;
+        }
+
+        status[length] = '\0';
+        info.voluntary_switches = status_field(status, "\nvoluntary_ctxt_switches:");
+        info.involuntary_switches = status_field(status, "\nnonvoluntary_ctxt_switches:");
+    }
+}
+
+namespace vms::core
+{
+    // --------------------------------------------------------------------- ThreadRegistry
+
+    std::size_t ThreadRegistry::snapshot(std::vector<ThreadInfo>& out, bool context_switches)
+    {
+        out.clear();
+
+        for (const ThreadRegistrySlot& slot : registry_slots)
+        {
+            const uint64_t serial = slot.serial.load(std::memory_order_acquire);
+
+            if (serial == 0)
+            {
+                continue;
+            }
+
+            ThreadInfo info;
+            info.thread = slot.thread.load(std::memory_order_relaxed);
+            info.serial = serial;
+            info.tid = slot.tid.load(std::memory_order_relaxed);
+            info.state = slot.state.load(std::memory_order_relaxed);
+            const uint64_t heartbeat = slot.heartbeat.load(std::memory_order_relaxed);
+            info.iterations = heartbeat >> 1;
+            info.in_run = (heartbeat & 1) != 0;
+
+            const uint64_t name_words[2] = {slot.name[0].load(std::memory_order_relaxed),
+                                            slot.name[1].load(std::memory_order_relaxed)};
+            std::memcpy(info.name, name_words, Thread::MAX_NAME_LENGTH);
+
+            const bool has_cpu_clock = slot.has_cpu_clock.load(std::memory_order_relaxed);
+            const clockid_t cpu_clock = slot.cpu_clock.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (slot.serial.load(std::memory_order_relaxed) != serial)
+            {
+                continue;
+            }
+
+            struct timespec cpu_time;
+
+            if (has_cpu_clock && clock_gettime(cpu_clock, &cpu_time) == 0)
+            {
+                info.cpu_time = std::chrono::seconds(cpu_time.tv_sec) + std::chrono::nanoseconds(cpu_time.tv_nsec);
+            }
+
+            if (context_switches && info.tid != 0)
+            {
+                read_context_switches(info.tid, info);
+            }
+
+            // The thread may have exited (and its tid been recycled) meanwhile.
+            if (slot.serial.load(std::memory_order_acquire) != serial)
+            {
+                continue;
+            }
+
+            out.push_back(info);
+        }
+
+        return out.size();
+    }
+
+    std::size_t ThreadRegistry::size()
+    {
+        std::size_t count = 0;
+
+        for (const ThreadRegistrySlot& slot : registry_slots)
+        {
+            count += slot.serial.load(std::memory_order_relaxed) != 0 ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    uint64_t ThreadRegistry::dropped()
+    {
+        return dropped_registrations.load(std::memory_order_relaxed);
+    }
+
+    const ThreadRegistrySlot& ThreadRegistry::slot_at(std::size_t index)
+    {
+        return registry_slots[index];
+    }
+
+    ThreadRegistrySlot* ThreadRegistry::acquire(const Thread* thread, const char* name,
+                                                std::chrono::nanoseconds watchdog_budget)
+    {
+        const std::size_t first = next_slot.fetch_add(1, std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < CAPACITY; ++i)
+        {
+            ThreadRegistrySlot& slot = registry_slots[(first + i) % CAPACITY];
+            bool expected = false;
+
+            if (slot.in_use.load(std::memory_order_relaxed) ||
+                !slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            slot.thread.store(thread, std::memory_order_relaxed);
+            slot.tid.store(0, std::memory_order_relaxed);
+            slot.has_cpu_clock.store(false, std::memory_order_relaxed);
+            slot.state.store(ThreadState::STARTING, std::memory_order_relaxed);
+            slot.heartbeat.store(0, std::memory_order_relaxed);
+            slot.watchdog_budget_ns.store(watchdog_budget.count(), std::memory_order_relaxed);
+            store_name(&slot, name);
+
+            // Publishing the serial makes the entry visible to snapshot().
+            slot.serial.store(next_serial.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_release);
+            return &slot;
+        }
+
+        dropped_registrations.fetch_add(1, std::memory_order_relaxed);
+        return &overflow_slot;
+    }
+
+    void ThreadRegistry::release(ThreadRegistrySlot* slot)
+    {
+        if (is_overflow(slot))
+        {
+            return;
+        }
+
+        slot->serial.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot->state.store(ThreadState::IDLE, std::memory_order_relaxed);
+        slot->has_cpu_clock.store(false, std::memory_order_relaxed);
+        slot->tid.store(0, std::memory_order_relaxed);
+        slot->thread.store(nullptr, std::memory_order_relaxed);
+        slot->in_use.store(false, std::memory_order_release);
+    }
+
+    void ThreadRegistry::store_name(ThreadRegistrySlot* slot, const char* name)
+    {
+        uint64_t words[2] = {0, 0};
+        std::memcpy(words, name, std::min(std::strlen(name), Thread::MAX_NAME_LENGTH));
+
+        slot->name[0].store(words[0], std::memory_order_relaxed);
+        slot->name[1].store(words[1], std::memory_order_relaxed);
+    }
+
+    bool ThreadRegistry::is_overflow(const ThreadRegistrySlot* slot)
+    {
+        return slot == &overflow_slot;
+    }
+}
@@ -5,8 +5,14 @@
 */
 
 #include <vms/core/thread_worker.h>
+#include <vms/core/cpu.h>
 
-#include <thread>
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <limits>
+#include <sys/timerfd.h>
+#include <unistd.h>
 
 namespace
 {
@@ -14,6 +20,27 @@ namespace
     {
         return std::chrono::microseconds{microseconds < 0 ? 0 : microseconds};
     }
+
+    struct timespec to_timespec(std::chrono::nanoseconds duration) noexcept
+    {
+        const auto secs = std::chrono::duration_cast<std::chrono::seconds>(duration);
+
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(secs.count());
+        ts.tv_nsec = static_cast<long>((duration - secs).count());
+        return ts;
+    }
+
+    uint64_t to_nanoseconds(std::chrono::steady_clock::duration duration) noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    /** @brief Initial HYBRID spin window, above the default 50us timer slack. */
+    constexpr int64_t default_spin_margin_ns = 100000;
+
+    /** @brief Lower bound of the calibrated spin window. */
+    constexpr int64_t min_spin_margin_ns = 5000;
 }
 
 namespace vms::core
@@ -29,7 +56,7 @@ namespace vms::core
     {
         if (sleep_duration_.count() > 0)
         {
-            std::this_thread::sleep_for(sleep_duration_);
+            sleep_for(sleep_duration_);
         }
     }
 
@@ -37,6 +64,22 @@ namespace vms::core
 
     HiResTimedThread::HiResTimedThread(int32_t micro_sec)
         : loop_interval_(make_non_negative_duration(micro_sec))
+        , precision_(TimerPrecision::SLEEP)
+        , spin_margin_ns_(default_spin_margin_ns)
+        , backend_(TimerBackend::STEADY_CLOCK)
+        , active_backend_(TimerBackend::STEADY_CLOCK)
+        , timer_fd_(-1)
+        , timer_error_(0)
+        , timer_lead_(0)
+        , timer_next_{}
+        , overrun_policy_(OverrunPolicy::RESET_PHASE)
+        , catch_up_limit_(std::numeric_limits<uint32_t>::max())
+        , overrun_count_(0)
+        , catch_up_remaining_(0)
+        , statistics_enabled_(false)
+        , run_start_{}
+        , previous_start_{}
+        , context_{}
         , next_deadline_{}
         , first_iteration_(true)
     {
@@ -51,8 +94,37 @@ namespace vms::core
 
         if (first_iteration_)
         {
-            next_deadline_ = Clock::now() + loop_interval_;
+            const auto now = Clock::now();
+
+            context_ = IterationContext{};
+            context_.deadline = now;
+            next_deadline_ = now + loop_interval_;
             first_iteration_ = false;
+
+            active_backend_ = backend_.load(std::memory_order_relaxed);
+
+            if (active_backend_ == TimerBackend::TIMERFD && !open_timer())
+            {
+                active_backend_ = TimerBackend::STEADY_CLOCK;
+                backend_.store(TimerBackend::STEADY_CLOCK, std::memory_order_relaxed);
+            }
+        }
+
+        if (statistics_enabled_.load(std::memory_order_relaxed))
+        {
+            const auto start = Clock::now();
+            const auto latency = std::max(start - context_.deadline, Clock::duration::zero());
+            const auto period = (previous_start_ == Clock::time_point{})
+                ? Clock::duration::zero()
+                : start - previous_start_;
+
+            statistics_.record_wakeup(to_nanoseconds(latency), to_nanoseconds(period));
+            previous_start_ = start;
+            run_start_ = start;
+        }
+        else if (previous_start_ != Clock::time_point{})
+        {
+            previous_start_ = Clock::time_point{};
         }
     }
 
@@ -63,23 +135,569 @@ namespace vms::core
             return;
         }
 
-        const auto now = Clock::now();
+        // On TIMERFD the clock is only read for the statistics and on overrun.
+        Clock::time_point now{};
 
-        if (now < next_deadline_)
+        if (active_backend_ == TimerBackend::STEADY_CLOCK || run_start_ != Clock::time_point{})
         {
-            std::this_thread::sleep_until(next_deadline_);
-            next_deadline_ += loop_interval_;
+            now = Clock::now();
         }
-        else
+
+        if (run_start_ != Clock::time_point{})
         {
-            next_deadline_ = now + loop_interval_;
+            statistics_.record_run(to_nanoseconds(now - run_start_));
+            run_start_ = Clock::time_point{};
+        }
+
+        auto slot = next_deadline_;
+        uint64_t missed = 0;
+        bool overrun = false;
+        bool due = false;
+
+        if (catch_up_remaining_ > 0)
+        {
+            // CATCH_UP burst in progress: the slot is already due.
+            --catch_up_remaining_;
+            due = true;
+
+            if (active_backend_ == TimerBackend::TIMERFD)
+            {
+                drain_timer();
+            }
+        }
+        else if (const uint64_t elapsed = elapsed_slots(now); elapsed > 0)
+        {
+            overrun = true;
+            missed = elapsed - 1;
+            overrun_count_.fetch_add(1, std::memory_order_relaxed);
+
+            switch (overrun_policy_.load(std::memory_order_relaxed))
+            {
+            case OverrunPolicy::RESET_PHASE:
+                slot = (now == Clock::time_point{}) ? Clock::now() : now;
+                due = true;
+
+                if (active_backend_ == TimerBackend::TIMERFD && !arm_timer(slot + loop_interval_, timer_lead_))
+                {
+                    fail_timer(errno);
+                }
+                break;
+
+            case OverrunPolicy::SKIP:
+                ++missed;
+                slot = next_deadline_ + missed * loop_interval_;
+                break;
+
+            case OverrunPolicy::CATCH_UP:
+            {
+                const uint64_t backlog = std::min<uint64_t>(missed, catch_up_limit_.load(std::memory_order_relaxed));
+                missed -= backlog;
+                slot = next_deadline_ + missed * loop_interval_;
+                catch_up_remaining_ = static_cast<uint32_t>(backlog);
+                due = true;
+                break;
+            }
+            }
+        }
+
+        if (!due && !wait_slot(slot))
+        {
+            // An interrupted wait runs an extra iteration and keeps the slot.
+            next_deadline_ = slot;
+            context_.deadline = Clock::now();
+            context_.missed_ticks = 0;
+            ++context_.index;
+            return;
+        }
+
+        next_deadline_ = slot + loop_interval_;
+        context_.deadline = slot;
+        context_.missed_ticks = missed;
+        ++context_.index;
+
+        if (overrun)
+        {
+            on_overrun(context_);
         }
     }
 
+    uint64_t HiResTimedThread::elapsed_slots(Clock::time_point& now)
+    {
+        if (active_backend_ == TimerBackend::TIMERFD && drain_timer())
+        {
+            // Every slot before timer_next_ has expired in the kernel.
+            if (timer_next_ <= next_deadline_)
+            {
+                return 0;
+            }
+
+            // Without a lead the expiration count is exact; with a HYBRID
+            // lead the last slot may still be inside its spin window.
+            if (timer_lead_.count() == 0)
+            {
+                return static_cast<uint64_t>((timer_next_ - next_deadline_) / loop_interval_);
+            }
+        }
+
+        if (now == Clock::time_point{})
+        {
+            now = Clock::now();
+        }
+
+        if (now < next_deadline_)
+        {
+            return 0;
+        }
+
+        return static_cast<uint64_t>((now - next_deadline_) / loop_interval_) + 1;
+    }
+
     void HiResTimedThread::uninit()
     {
+        if (timer_fd_ >= 0)
+        {
+            close(timer_fd_);
+            timer_fd_ = -1;
+        }
+
+        timer_lead_ = std::chrono::nanoseconds::zero();
+        timer_next_ = Clock::time_point{};
+        catch_up_remaining_ = 0;
+        run_start_ = Clock::time_point{};
+        previous_start_ = Clock::time_point{};
+        active_backend_ = TimerBackend::STEADY_CLOCK;
+        context_ = IterationContext{};
         first_iteration_ = true;
         next_deadline_ = Clock::time_point{};
         Thread::uninit();
     }
+
+    void HiResTimedThread::set_backend(TimerBackend backend)
+    {
+        backend_.store(backend, std::memory_order_relaxed);
+    }
+
+    TimerBackend HiResTimedThread::backend() const
+    {
+        return backend_.load(std::memory_order_relaxed);
+    }
+
+    int HiResTimedThread::timer_error() const
+    {
+        return timer_error_.load(std::memory_order_relaxed);
+    }
+
+    const IterationContext& HiResTimedThread::iteration_context() const noexcept
+    {
+        return context_;
+    }
+
+    bool HiResTimedThread::wait_slot(Clock::time_point slot)
+    {
+        if (active_backend_ == TimerBackend::STEADY_CLOCK)
+        {
+            return wait_deadline(slot);
+        }
+
+        return wait_timer(slot);
+    }
+
+    bool HiResTimedThread::open_timer()
+    {
+        timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+        if (timer_fd_ < 0)
+        {
+            timer_error_.store(errno, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (!arm_timer(next_deadline_, desired_lead()))
+        {
+            timer_error_.store(errno, std::memory_order_relaxed);
+            close(timer_fd_);
+            timer_fd_ = -1;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool HiResTimedThread::arm_timer(Clock::time_point first_slot, std::chrono::nanoseconds lead)
+    {
+        struct itimerspec spec{};
+        spec.it_value = to_timespec((first_slot - lead).time_since_epoch());
+        spec.it_interval = to_timespec(loop_interval_);
+
+        if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+        {
+            return false;
+        }
+
+        timer_next_ = first_slot;
+        timer_lead_ = lead;
+        return true;
+    }
+
+    bool HiResTimedThread::wait_timer(Clock::time_point slot)
+    {
+        bool waited = false;
+
+        // Each expiration read back moves timer_next_ one slot along the grid.
+        while (timer_next_ <= slot)
+        {
+            if (!drain_timer())
+            {
+                // A broken timer is never reported as a wake-up.
+                return wait_deadline(slot);
+            }
+
+            if (timer_next_ > slot)
+            {
+                break;
+            }
+
+            if (!wait_readable(timer_fd_))
+            {
+                return false;
+            }
+
+            waited = true;
+        }
+
+        if (timer_lead_.count() > 0)
+        {
+            // HYBRID: the timer fires timer_lead_ ahead of the slot, spin the rest.
+            if (waited)
+            {
+                calibrate_margin(Clock::now() - (slot - timer_lead_));
+            }
+
+            while (Clock::now() < slot)
+            {
+                cpu_relax();
+            }
+        }
+
+        const auto lead = desired_lead();
+
+        // Re-arming costs a syscall: only follow significant margin changes.
+        const auto drift = (lead > timer_lead_) ? (lead - timer_lead_) : (timer_lead_ - lead);
+
+        // The slot has been reached: a failed re-arm only affects the next waits.
+        if (((lead.count() == 0) != (timer_lead_.count() == 0) || drift > timer_lead_ / 8)
+            && !arm_timer(timer_next_, lead))
+        {
+            fail_timer(errno);
+        }
+
+        return true;
+    }
+
+    bool HiResTimedThread::drain_timer()
+    {
+        uint64_t expirations = 0;
+
+        if (read(timer_fd_, &expirations, sizeof(expirations)) == static_cast<ssize_t>(sizeof(expirations)))
+        {
+            timer_next_ += expirations * loop_interval_;
+            return true;
+        }
+
+        if (errno == EAGAIN || errno == EINTR)
+        {
+            return true;
+        }
+
+        fail_timer(errno);
+        return false;
+    }
+
+    void HiResTimedThread::fail_timer(int error)
+    {
+        timer_error_.store(error, std::memory_order_relaxed);
+        close(timer_fd_);
+        timer_fd_ = -1;
+        timer_lead_ = std::chrono::nanoseconds::zero();
+        active_backend_ = TimerBackend::STEADY_CLOCK;
+        backend_.store(TimerBackend::STEADY_CLOCK, std::memory_order_relaxed);
+    }
+
+    std::chrono::nanoseconds HiResTimedThread::desired_lead() const
+    {
+        if (precision_.load(std::memory_order_relaxed) == TimerPrecision::HYBRID)
+        {
+            return spin_margin();
+        }
+
+        return std::chrono::nanoseconds::zero();
+    }
+
+    void HiResTimedThread::set_overrun_policy(OverrunPolicy policy)
+    {
+        overrun_policy_.store(policy, std::memory_order_relaxed);
+    }
+
+    OverrunPolicy HiResTimedThread::overrun_policy() const
+    {
+        return overrun_policy_.load(std::memory_order_relaxed);
+    }
+
+    void HiResTimedThread::set_catch_up_limit(uint32_t max_burst)
+    {
+        catch_up_limit_.store(max_burst, std::memory_order_relaxed);
+    }
+
+    uint32_t HiResTimedThread::catch_up_limit() const
+    {
+        return catch_up_limit_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t HiResTimedThread::overrun_count() const
+    {
+        return overrun_count_.load(std::memory_order_relaxed);
+    }
+
+    void HiResTimedThread::enable_statistics(bool enabled /*= true*/)
+    {
+        statistics_enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool HiResTimedThread::statistics_enabled() const
+    {
+        return statistics_enabled_.load(std::memory_order_relaxed);
+    }
+
+    LoopStatisticsSnapshot HiResTimedThread::statistics() const
+    {
+        return statistics_.snapshot();
+    }
+
+    void HiResTimedThread::reset_statistics()
+    {
+        statistics_.request_reset();
+    }
+
+    void HiResTimedThread::on_overrun(const IterationContext& /*context*/)
+    {
+    }
+
+    void HiResTimedThread::set_precision(TimerPrecision precision)
+    {
+        precision_.store(precision, std::memory_order_relaxed);
+    }
+
+    TimerPrecision HiResTimedThread::precision() const
+    {
+        return precision_.load(std::memory_order_relaxed);
+    }
+
+    std::chrono::nanoseconds HiResTimedThread::spin_margin() const
+    {
+        return std::chrono::nanoseconds(spin_margin_ns_.load(std::memory_order_relaxed));
+    }
+
+    bool HiResTimedThread::wait_deadline(Clock::time_point deadline)
+    {
+        if (precision_.load(std::memory_order_relaxed) == TimerPrecision::SLEEP)
+        {
+            return sleep_until(deadline);
+        }
+
+        const auto target = deadline - spin_margin();
+
+        if (Clock::now() < target)
+        {
+            if (!sleep_until(target))
+            {
+                return false;
+            }
+
+            calibrate_margin(Clock::now() - target);
+        }
+
+        while (Clock::now() < deadline)
+        {
+            cpu_relax();
+        }
+
+        return true;
+    }
+
+    void HiResTimedThread::calibrate_margin(std::chrono::nanoseconds oversleep)
+    {
+        const int64_t observed = oversleep.count();
+        int64_t margin = spin_margin_ns_.load(std::memory_order_relaxed);
+
+        if (observed > margin)
+        {
+            // Late wake-up: widen at once, with 25% headroom.
+            margin = observed + observed / 4;
+        }
+        else
+        {
+            // Punctual wake-up: shrink towards 2x the observed oversleep.
+            margin -= (margin - 2 * observed) / 64;
+        }
+
+        const int64_t max_margin = std::chrono::nanoseconds(loop_interval_).count();
+        margin = std::clamp(margin, min_spin_margin_ns, std::max(min_spin_margin_ns, max_margin));
+
+        spin_margin_ns_.store(margin, std::memory_order_relaxed);
+    }
+
+    // ------------------------------------------------------------------ EventThread
+
+    void EventThread::notify()
+    {
+        wake();
+    }
+
+    void EventThread::pre_run()
+    {
+        wait_for_wake();
+    }
+
+    // ---------------------------------------------------------------- PollingThread
+
+    PollingThread::PollingThread(const IdleConfig& config /*= IdleConfig{}*/)
+        : strategy_(config.strategy)
+        , spin_rounds_(config.spin_rounds)
+        , yield_rounds_(config.yield_rounds)
+        , max_backoff_us_(config.max_backoff.count())
+        , park_timeout_us_(config.park_timeout.count())
+        , idle_rounds_(0)
+    {
+    }
+
+    void PollingThread::set_idle_config(const IdleConfig& config)
+    {
+        spin_rounds_.store(config.spin_rounds, std::memory_order_relaxed);
+        yield_rounds_.store(config.yield_rounds, std::memory_order_relaxed);
+        max_backoff_us_.store(config.max_backoff.count(), std::memory_order_relaxed);
+        park_timeout_us_.store(config.park_timeout.count(), std::memory_order_relaxed);
+        strategy_.store(config.strategy, std::memory_order_relaxed);
+    }
+
+    IdleConfig PollingThread::idle_config() const
+    {
+        IdleConfig config;
+        config.strategy = strategy_.load(std::memory_order_relaxed);
+        config.spin_rounds = spin_rounds_.load(std::memory_order_relaxed);
+        config.yield_rounds = yield_rounds_.load(std::memory_order_relaxed);
+        config.max_backoff = std::chrono::microseconds(max_backoff_us_.load(std::memory_order_relaxed));
+        config.park_timeout = std::chrono::microseconds(park_timeout_us_.load(std::memory_order_relaxed));
+        return config;
+    }
+
+    void PollingThread::notify()
+    {
+        wake();
+    }
+
+    void PollingThread::run()
+    {
+        if (poll())
+        {
+            idle_rounds_ = 0;
+            return;
+        }
+
+        idle();
+
+        if (idle_rounds_ != std::numeric_limits<uint32_t>::max())
+        {
+            ++idle_rounds_;
+        }
+    }
+
+    void PollingThread::idle()
+    {
+        const IdleStrategy strategy = strategy_.load(std::memory_order_relaxed);
+        const uint32_t spin_rounds = spin_rounds_.load(std::memory_order_relaxed);
+
+        if (strategy == IdleStrategy::BUSY_SPIN || idle_rounds_ < spin_rounds)
+        {
+            cpu_relax();
+            return;
+        }
+
+        const uint32_t escalation = idle_rounds_ - spin_rounds;
+
+        switch (strategy)
+        {
+        case IdleStrategy::BACKOFF:
+        {
+            // 1us, 2us, 4us ... capped to max_backoff.
+            const auto max_backoff = std::chrono::microseconds(max_backoff_us_.load(std::memory_order_relaxed));
+            const auto backoff = std::chrono::microseconds(int64_t{1} << std::min<uint32_t>(escalation, 30));
+            sleep_for(std::min(backoff, max_backoff));
+            break;
+        }
+
+        case IdleStrategy::SPIN_YIELD:
+            sched_yield();
+            break;
+
+        case IdleStrategy::SPIN_PARK:
+        {
+            const auto park_timeout = std::chrono::microseconds(park_timeout_us_.load(std::memory_order_relaxed));
+
+            if (escalation < yield_rounds_.load(std::memory_order_relaxed))
+            {
+                sched_yield();
+            }
+            else if (park_timeout.count() > 0)
+            {
+                sleep_for(park_timeout);
+            }
+            else
+            {
+                wait_for_wake();
+            }
+            break;
+        }
+
+        case IdleStrategy::BUSY_SPIN:
+            break;
+        }
+    }
+
+    // ---------------------------------------------------------------- BatchedThread
+
+    BatchedThread::BatchedThread(std::size_t batch_size, const IdleConfig& config /*= IdleConfig{}*/)
+        : PollingThread(config)
+        , batch_size_(std::max<std::size_t>(batch_size, 1))
+        , processed_(0)
+    {
+    }
+
+    void BatchedThread::set_batch_size(std::size_t batch_size)
+    {
+        batch_size_.store(std::max<std::size_t>(batch_size, 1), std::memory_order_relaxed);
+    }
+
+    std::size_t BatchedThread::batch_size() const
+    {
+        return batch_size_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t BatchedThread::processed_count() const
+    {
+        return processed_.load(std::memory_order_relaxed);
+    }
+
+    bool BatchedThread::poll()
+    {
+        const std::size_t processed = run_batch(batch_size_.load(std::memory_order_relaxed));
+
+        if (processed == 0)
+        {
+            return false;
+        }
+
+        // Single writer: a plain load + store instead of a locked increment.
+        processed_.store(processed_.load(std::memory_order_relaxed) + processed, std::memory_order_relaxed);
+        return true;
+    }
 }
@@ -0,0 +1,385 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/timer_service.h>
+#include <vms/core/thread_pool.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace vms::core
+{
+    // --------------------------------------------------------------------- TimerService
+
+    TimerService::TimerService(int32_t tick_micro_sec, std::size_t max_timers)
+        : HiResTimedThread(std::max<int32_t>(tick_micro_sec, 1))
+        , tick_(std::chrono::microseconds(std::max<int32_t>(tick_micro_sec, 1)))
+        , max_nodes_(std::min<std::size_t>(std::max<std::size_t>(max_timers, 1), NIL - 1))
+        , origin_(Clock::now())
+        , chunks_(std::make_unique<std::unique_ptr<Node[]>[]>(((max_nodes_ - 1) >> CHUNK_BITS) + 1))
+        , allocated_nodes_(0)
+        , free_list_(NIL)
+        , active_(0)
+        , current_tick_(0)
+        , pool_(nullptr)
+        , pool_in_flight_(0)
+    {
+        wheel_.fill(NIL);
+        wheel_count_.fill(0);
+    }
+
+    TimerService::~TimerService()
+    {
+        stop();
+
+        while (pool_in_flight_.load(std::memory_order_acquire) != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void TimerService::set_dispatch_pool(ThreadPool* pool)
+    {
+        pool_.store(pool, std::memory_order_release);
+    }
+
+    TimerService::TimerId TimerService::schedule_after(std::chrono::nanoseconds delay, Callback callback)
+    {
+        return add_timer(delay, 0, std::move(callback));
+    }
+
+    TimerService::TimerId TimerService::schedule_every(std::chrono::nanoseconds period, Callback callback,
+                                                       std::chrono::nanoseconds first_delay)
+    {
+        return add_timer(first_delay, to_ticks(period), std::move(callback));
+    }
+
+    TimerService::TimerId TimerService::schedule_every(std::chrono::nanoseconds period, Callback callback)
+    {
+        return schedule_every(period, std::move(callback), period);
+    }
+
+    bool TimerService::cancel(TimerId id)
+    {
+        const auto low = static_cast<uint32_t>(id);
+
+        if (low == 0 || low > max_nodes_)
+        {
+            return false;
+        }
+
+        const uint32_t index = low - 1;
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (index >= allocated_nodes_)
+        {
+            return false;
+        }
+
+        Node& timer = node(index);
+
+        if (timer.generation != static_cast<uint32_t>(id >> 32))
+        {
+            return false;
+        }
+
+        switch (timer.state)
+        {
+        case NodeState::ARMED:
+            unlink(index);
+            release_node(index);
+            return true;
+        case NodeState::FIRING:
+            // The callback is running outside the lock: let fire() release it.
+            timer.state = NodeState::FIRING_CANCELLED;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    std::size_t TimerService::active_timers() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return active_;
+    }
+
+    std::chrono::nanoseconds TimerService::tick() const
+    {
+        return tick_;
+    }
+
+    void TimerService::run()
+    {
+        const auto elapsed = Clock::now() - origin_;
+        const auto now_tick = static_cast<uint64_t>(elapsed / tick_);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            while (current_tick_ <= now_tick)
+            {
+                advance();
+            }
+        }
+
+        if (expired_.empty())
+        {
+            return;
+        }
+
+        ThreadPool* pool = pool_.load(std::memory_order_acquire);
+
+        if (pool == nullptr)
+        {
+            for (const uint32_t index : expired_)
+            {
+                node(index).callback();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            for (const uint32_t index : expired_)
+            {
+                finish(index);
+            }
+        }
+        else
+        {
+            pool_in_flight_.fetch_add(static_cast<uint32_t>(expired_.size()), std::memory_order_relaxed);
+
+            for (const uint32_t index : expired_)
+            {
+                pool->submit([this, index] { fire(index); });
+            }
+        }
+
+        expired_.clear();
+    }
+
+    TimerService::Node& TimerService::node(uint32_t index) const noexcept
+    {
+        return chunks_[index >> CHUNK_BITS][index & ((1U << CHUNK_BITS) - 1)];
+    }
+
+    uint32_t TimerService::allocate_node()
+    {
+        if (free_list_ != NIL)
+        {
+            const uint32_t index = free_list_;
+            free_list_ = node(index).next;
+            return index;
+        }
+
+        if (allocated_nodes_ == max_nodes_)
+        {
+            return NIL;
+        }
+
+        const auto index = static_cast<uint32_t>(allocated_nodes_);
+
+        if ((index & ((1U << CHUNK_BITS) - 1)) == 0)
+        {
+            chunks_[index >> CHUNK_BITS] = std::make_unique<Node[]>(std::size_t{1} << CHUNK_BITS);
+        }
+
+        ++allocated_nodes_;
+        return index;
+    }
+
+    void TimerService::release_node(uint32_t index)
+    {
+        Node& timer = node(index);
+
+        timer.callback.reset();
+        timer.state = NodeState::FREE;
+        ++timer.generation;
+        timer.next = free_list_;
+        free_list_ = index;
+        --active_;
+    }
+
+    TimerService::TimerId TimerService::add_timer(std::chrono::nanoseconds delay, uint64_t period_ticks,
+                                                  Callback&& callback)
+    {
+        // First tick boundary at or after now + delay, so the timer never fires early.
+        const auto due = Clock::now() - origin_ + std::max(delay, std::chrono::nanoseconds(0));
+        const auto due_tick = static_cast<uint64_t>((due + tick_ - std::chrono::nanoseconds(1)) / tick_);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint32_t index = allocate_node();
+
+        if (index == NIL)
+        {
+            return INVALID_TIMER;
+        }
+
+        Node& timer = node(index);
+        timer.callback = std::move(callback);
+        timer.expiry = std::max(due_tick, current_tick_);
+        timer.period = period_ticks;
+        timer.state = NodeState::ARMED;
+        ++active_;
+
+        insert(index);
+        return (static_cast<TimerId>(timer.generation) << 32) | (index + 1);
+    }
+
+    void TimerService::insert(uint32_t index)
+    {
+        Node& timer = node(index);
+
+        // Lowest level whose current and next laps reach the expiry.
+        unsigned level = 0;
+
+        while (level + 1 < LEVELS &&
+               (timer.expiry >> (LEVEL_BITS * (level + 1))) > (current_tick_ >> (LEVEL_BITS * (level + 1))) + 1)
+        {
+            ++level;
+        }
+
+        uint64_t unit = timer.expiry >> (LEVEL_BITS * level);
+        const uint64_t current_lap = current_tick_ >> (LEVEL_BITS * (level + 1));
+
+        // Beyond the top level's two laps: park at the end of the next lap,
+        // draining that slot re-inserts the timer one lap further.
+        if ((unit >> LEVEL_BITS) > current_lap + 1)
+        {
+            unit = ((current_lap + 2) << LEVEL_BITS) - 1;
+        }
+
+        const auto list = static_cast<uint32_t>((level * 2 + ((unit >> LEVEL_BITS) & 1)) * LEVEL_SLOTS +
+                                                (unit & (LEVEL_SLOTS - 1)));
+        uint32_t& head = wheel_[list];
+
+        timer.list = static_cast<uint16_t>(list);
+        timer.prev = NIL;
+        timer.next = head;
+
+        if (head != NIL)
+        {
+            node(head).prev = index;
+        }
+
+        head = index;
+        ++wheel_count_[list];
+    }
+
+    void TimerService::unlink(uint32_t index)
+    {
+        Node& timer = node(index);
+
+        if (timer.prev != NIL)
+        {
+            node(timer.prev).next = timer.next;
+        }
+        else
+        {
+            wheel_[timer.list] = timer.next;
+        }
+
+        if (timer.next != NIL)
+        {
+            node(timer.next).prev = timer.prev;
+        }
+
+        --wheel_count_[timer.list];
+    }
+
+    void TimerService::drain(unsigned level)
+    {
+        const unsigned shift = LEVEL_BITS * level;
+        const uint64_t unit = (current_tick_ >> shift) + 1;
+        const auto list = static_cast<uint32_t>((level * 2 + ((unit >> LEVEL_BITS) & 1)) * LEVEL_SLOTS +
+                                                (unit & (LEVEL_SLOTS - 1)));
+
+        if (wheel_count_[list] == 0)
+        {
+            return;
+        }
+
+        const uint64_t unit_ticks = uint64_t{1} << shift;
+        const uint64_t ticks_left = unit_ticks - (current_tick_ & (unit_ticks - 1));
+        uint64_t moves = (wheel_count_[list] + ticks_left - 1) / ticks_left;
+
+        while (moves-- > 0)
+        {
+            const uint32_t index = wheel_[list];
+            unlink(index);
+            insert(index);
+        }
+    }
+
+    void TimerService::advance()
+    {
+        for (unsigned level = LEVELS - 1; level > 0; --level)
+        {
+            drain(level);
+        }
+
+        const auto list = static_cast<uint32_t>(((current_tick_ >> LEVEL_BITS) & 1) * LEVEL_SLOTS +
+                                                (current_tick_ & (LEVEL_SLOTS - 1)));
+        uint32_t index = std::exchange(wheel_[list], NIL);
+        wheel_count_[list] = 0;
+
+        while (index != NIL)
+        {
+            Node& timer = node(index);
+            const uint32_t next = timer.next;
+
+            timer.state = NodeState::FIRING;
+            expired_.push_back(index);
+            index = next;
+        }
+
+        ++current_tick_;
+    }
+
+    void TimerService::fire(uint32_t index)
+    {
+        node(index).callback();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            finish(index);
+        }
+
+        pool_in_flight_.fetch_sub(1, std::memory_order_release);
+    }
+
+    void TimerService::finish(uint32_t index)
+    {
+        Node& timer = node(index);
+
+        if (timer.state == NodeState::FIRING_CANCELLED || timer.period == 0)
+        {
+            release_node(index);
+            return;
+        }
+
+        // Keep the phase, skipping the periods that went by while firing.
+        timer.expiry += timer.period;
+
+        if (timer.expiry < current_tick_)
+        {
+            const uint64_t behind = current_tick_ - timer.expiry;
+            timer.expiry += ((behind + timer.period - 1) / timer.period) * timer.period;
+        }
+
+        timer.state = NodeState::ARMED;
+        insert(index);
+    }
+
+    uint64_t TimerService::to_ticks(std::chrono::nanoseconds period) const
+    {
+        if (period <= tick_)
+        {
+            return 1;
+        }
+
+        return static_cast<uint64_t>((period + tick_ - std::chrono::nanoseconds(1)) / tick_);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+#include <vms/core/watchdog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace vms::core
+{
+    // --------------------------------------------------------------------- Watchdog
+
+    Watchdog::Watchdog(Callback callback, std::chrono::nanoseconds default_budget, int32_t scan_micro_sec)
+        : TimedThread(scan_micro_sec)
+        , callback_(std::move(callback))
+        , default_budget_ns_(default_budget.count())
+        , stall_count_(0)
+        , observations_(ThreadRegistry::CAPACITY)
+    {
+    }
+
+    Watchdog::~Watchdog()
+    {
+        stop();
+    }
+
+    void Watchdog::set_default_budget(std::chrono::nanoseconds budget)
+    {
+        default_budget_ns_.store(budget.count(), std::memory_order_relaxed);
+    }
+
+    std::chrono::nanoseconds Watchdog::default_budget() const
+    {
+        return std::chrono::nanoseconds(default_budget_ns_.load(std::memory_order_relaxed));
+    }
+
+    uint64_t Watchdog::stall_count() const
+    {
+        return stall_count_.load(std::memory_order_relaxed);
+    }
+
+    bool Watchdog::init()
+    {
+        std::fill(observations_.begin(), observations_.end(), Observation{});
+        return true;
+    }
+
+    void Watchdog::run()
+    {
+        const auto now = Clock::now();
+        const int64_t default_budget = default_budget_ns_.load(std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < observations_.size(); ++i)
+        {
+            const ThreadRegistrySlot& slot = ThreadRegistry::slot_at(i);
+            Observation& seen = observations_[i];
+
+            const uint64_t serial = slot.serial.load(std::memory_order_acquire);
+            const uint64_t heartbeat = slot.heartbeat.load(std::memory_order_relaxed);
+
+            if (serial != seen.serial || heartbeat != seen.heartbeat)
+            {
+                seen = Observation{serial, heartbeat, now, false};
+                continue;
+            }
+
+            if (serial == 0 || (heartbeat & 1) == 0 || seen.reported)
+            {
+                continue;
+            }
+
+            const int64_t own_budget = slot.watchdog_budget_ns.load(std::memory_order_relaxed);
+            const auto budget = std::chrono::nanoseconds(own_budget != 0 ? own_budget : default_budget);
+            const auto stuck_for = now - seen.since;
+
+            if (stuck_for <= budget)
+            {
+                continue;
+            }
+
+            StallReport report;
+            report.thread = slot.thread.load(std::memory_order_relaxed);
+            report.tid = slot.tid.load(std::memory_order_relaxed);
+            report.iteration = heartbeat >> 1;
+            report.stuck_for = std::chrono::duration_cast<std::chrono::nanoseconds>(stuck_for);
+
+            const uint64_t name_words[2] = {slot.name[0].load(std::memory_order_relaxed),
+                                            slot.name[1].load(std::memory_order_relaxed)};
+            std::memcpy(report.name, name_words, Thread::MAX_NAME_LENGTH);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (slot.serial.load(std::memory_order_relaxed) != serial)
+            {
+                continue;
+            }
+
+            seen.reported = true;
+            stall_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (callback_)
+            {
+                callback_(report);
+            }
+        }
+    }
+}
@@ -0,0 +1,245 @@
+#include <vms/core/event.h>
+#include <vms/core/thread_base.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    using TestClock = std::chrono::steady_clock;
+
+    template <typename Predicate>
+    bool wait_for_condition(Predicate&& predicate, std::chrono::milliseconds timeout)
+    {
+        const auto deadline = TestClock::now() + timeout;
+
+        while (!predicate())
+        {
+            if (TestClock::now() >= deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    /** @brief Worker counting how many times its event let wait_event() through. */
+    class EventWaitingThread : public vms::core::Thread
+    {
+    public:
+        explicit EventWaitingThread(vms::core::Event& event) : event_(event) {}
+
+        ~EventWaitingThread() override
+        {
+            stop();
+        }
+
+        int signaled() const { return signaled_.load(); }
+        int interrupted() const { return interrupted_.load(); }
+
+    protected:
+        void run() override
+        {
+            if (wait_event(event_))
+            {
+                signaled_.fetch_add(1);
+            }
+            else
+            {
+                interrupted_.fetch_add(1);
+            }
+        }
+
+    private:
+        vms::core::Event& event_;
+        std::atomic<int> signaled_{0};
+        std::atomic<int> interrupted_{0};
+    };
+
+    bool test_manual_reset_event()
+    {
+        vms::core::Event event(vms::core::EventMode::MANUAL_RESET);
+        std::atomic<int> released{0};
+
+        std::thread first([&] { event.wait(); released.fetch_add(1); });
+        std::thread second([&] { event.wait(); released.fetch_add(1); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const int before_set = released.load();
+        event.set();
+        first.join();
+        second.join();
+
+        if (before_set != 0 || released.load() != 2 || !event.is_set() || !event.try_wait())
+        {
+            std::cerr << "[ManualResetEvent] Waiters not released together\n";
+            return false;
+        }
+
+        event.reset();
+
+        if (event.is_set() || event.wait_for(std::chrono::milliseconds(10)))
+        {
+            std::cerr << "[ManualResetEvent] reset() did not clear the event\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_auto_reset_event()
+    {
+        vms::core::Event event(vms::core::EventMode::AUTO_RESET);
+        std::atomic<int> released{0};
+
+        auto waiter = [&] {
+            if (event.wait_for(std::chrono::milliseconds(200)))
+            {
+                released.fetch_add(1);
+            }
+        };
+
+        std::thread first(waiter);
+        std::thread second(waiter);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        event.set();
+        first.join();
+        second.join();
+
+        if (released.load() != 1 || event.is_set())
+        {
+            std::cerr << "[AutoResetEvent] One set() released " << released.load() << " waiters\n";
+            return false;
+        }
+
+        event.set();
+
+        if (!event.try_wait() || event.try_wait())
+        {
+            std::cerr << "[AutoResetEvent] try_wait() did not consume the event once\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_binary_semaphore()
+    {
+        vms::core::BinarySemaphore ping;
+        vms::core::BinarySemaphore pong;
+        constexpr int rounds = 1000;
+
+        std::thread peer([&] {
+            for (int i = 0; i < rounds; ++i)
+            {
+                ping.acquire();
+                pong.release();
+            }
+        });
+
+        bool timed_out = false;
+
+        for (int i = 0; i < rounds && !timed_out; ++i)
+        {
+            ping.release();
+            timed_out = !pong.try_acquire_for(std::chrono::seconds(1));
+        }
+
+        peer.join();
+
+        if (timed_out)
+        {
+            std::cerr << "[BinarySemaphore] Ping-pong stalled\n";
+            return false;
+        }
+
+        vms::core::BinarySemaphore semaphore(true);
+        semaphore.release();
+
+        if (!semaphore.try_acquire() || semaphore.try_acquire())
+        {
+            std::cerr << "[BinarySemaphore] Token count exceeded one\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_wait_event()
+    {
+        vms::core::Event event(vms::core::EventMode::AUTO_RESET);
+        EventWaitingThread worker(event);
+        worker.start();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            event.set();
+
+            if (!wait_for_condition([&] { return worker.signaled() == i + 1; }, std::chrono::milliseconds(1000)))
+            {
+                std::cerr << "[ThreadWaitEvent] Signal " << i << " not delivered\n";
+                return false;
+            }
+        }
+
+        worker.wake();
+
+        if (!wait_for_condition([&] { return worker.interrupted() >= 1; }, std::chrono::milliseconds(1000)))
+        {
+            std::cerr << "[ThreadWaitEvent] wake() did not interrupt the wait\n";
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        const auto stop_begin = TestClock::now();
+        worker.stop();
+
+        if (TestClock::now() - stop_begin > std::chrono::milliseconds(500))
+        {
+            std::cerr << "[ThreadWaitEvent] stop() did not interrupt the wait\n";
+            return false;
+        }
+
+        return worker.signaled() == 100;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"Manual reset Event", &test_manual_reset_event},
+        {"Auto reset Event", &test_auto_reset_event},
+        {"BinarySemaphore", &test_binary_semaphore},
+        {"Thread wait_event", &test_thread_wait_event},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
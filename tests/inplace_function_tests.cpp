@@ -0,0 +1,217 @@
+#include <vms/core/inplace_function.h>
+#include <vms/core/mpmc_queue.h>
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+namespace
+{
+    static_assert(sizeof(vms::core::InplaceTask) == vms::core::cache_line_size);
+    static_assert(std::is_nothrow_move_constructible_v<vms::core::InplaceTask>);
+    static_assert(!std::is_copy_constructible_v<vms::core::InplaceTask>);
+
+    /** @brief Callable tracking how many instances are alive. */
+    struct Tracked
+    {
+        explicit Tracked(int& live)
+            : live_(&live)
+        {
+            ++*live_;
+        }
+
+        Tracked(Tracked&& other) noexcept
+            : live_(other.live_)
+        {
+            ++*live_;
+        }
+
+        ~Tracked()
+        {
+            --*live_;
+        }
+
+        int operator()(int value) const
+        {
+            return value + 1;
+        }
+
+        int* live_;
+    };
+
+    bool test_inplace_function_invoke()
+    {
+        vms::core::InplaceFunction<int(int, int)> add = [](int a, int b) { return a + b; };
+
+        if (!add || add(2, 3) != 5)
+        {
+            std::cerr << "[InplaceFunctionInvoke] Stored lambda returned a wrong result\n";
+            return false;
+        }
+
+        // Mutable state and a capture filling most of the buffer.
+        std::array<uint64_t, 5> payload{1, 2, 3, 4, 5};
+        vms::core::InplaceFunction<uint64_t()> counter = [payload, calls = uint64_t{0}]() mutable {
+            return payload[4] * 100 + ++calls;
+        };
+
+        if (counter() != 501 || counter() != 502)
+        {
+            std::cerr << "[InplaceFunctionInvoke] Mutable state was not kept between calls\n";
+            return false;
+        }
+
+        // Move-only captures are accepted.
+        vms::core::InplaceFunction<int()> owner = [value = std::make_unique<int>(9)] { return *value; };
+
+        if (owner() != 9)
+        {
+            std::cerr << "[InplaceFunctionInvoke] Move-only capture lost\n";
+            return false;
+        }
+
+        vms::core::InplaceFunction<void()> empty;
+        vms::core::InplaceFunction<void()> null = nullptr;
+
+        if (empty || null)
+        {
+            std::cerr << "[InplaceFunctionInvoke] Default constructed function is not empty\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_inplace_function_discards_result()
+    {
+        int calls = 0;
+        vms::core::InplaceTask task = [&calls] { return ++calls; };
+        vms::core::InplaceFunction<void(int)> sink = [&calls](int value) { calls += value; return calls; };
+
+        task();
+        sink(10);
+
+        if (calls != 11)
+        {
+            std::cerr << "[InplaceFunctionDiscardsResult] Value-returning callable not invoked\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_inplace_function_lifetime()
+    {
+        int live = 0;
+
+        {
+            vms::core::InplaceFunction<int(int)> first = Tracked(live);
+
+            if (live != 1)
+            {
+                std::cerr << "[InplaceFunctionLifetime] Expected 1 live callable, got " << live << '\n';
+                return false;
+            }
+
+            vms::core::InplaceFunction<int(int)> second = std::move(first);
+
+            if (live != 1 || first || !second || second(1) != 2)
+            {
+                std::cerr << "[InplaceFunctionLifetime] Move did not transfer the callable\n";
+                return false;
+            }
+
+            vms::core::InplaceFunction<int(int)> third = Tracked(live);
+            third = std::move(second);
+
+            if (live != 1 || second || third(2) != 3)
+            {
+                std::cerr << "[InplaceFunctionLifetime] Move assignment leaked or lost a callable\n";
+                return false;
+            }
+
+            third = nullptr;
+
+            if (live != 0 || third)
+            {
+                std::cerr << "[InplaceFunctionLifetime] Reset did not destroy the callable\n";
+                return false;
+            }
+
+            vms::core::InplaceFunction<int(int)> scoped = Tracked(live);
+        }
+
+        if (live != 0)
+        {
+            std::cerr << "[InplaceFunctionLifetime] " << live << " callables leaked\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_inplace_function_in_queue()
+    {
+        vms::core::MpmcQueue<vms::core::InplaceTask> queue(8);
+        uint64_t sum = 0;
+
+        for (uint64_t i = 1; i <= 8; ++i)
+        {
+            if (!queue.try_push([&sum, i] { sum += i; }))
+            {
+                std::cerr << "[InplaceFunctionInQueue] Push rejected\n";
+                return false;
+            }
+        }
+
+        vms::core::InplaceTask task;
+
+        while (queue.try_pop(task))
+        {
+            task();
+        }
+
+        if (sum != 36)
+        {
+            std::cerr << "[InplaceFunctionInQueue] Expected sum 36, got " << sum << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"InplaceFunction invoke", &test_inplace_function_invoke},
+        {"InplaceFunction discards result", &test_inplace_function_discards_result},
+        {"InplaceFunction lifetime", &test_inplace_function_lifetime},
+        {"InplaceFunction in queue", &test_inplace_function_in_queue},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+#include <vms/core/mpmc_queue.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    bool test_mpmc_queue_capacity()
+    {
+        vms::core::MpmcQueue<int> queue(3);
+
+        if (queue.capacity() != 4)
+        {
+            std::cerr << "[MpmcQueueCapacity] Expected capacity 4, got " << queue.capacity() << '\n';
+            return false;
+        }
+
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                if (!queue.try_push(i))
+                {
+                    std::cerr << "[MpmcQueueCapacity] Push rejected before full\n";
+                    return false;
+                }
+            }
+
+            if (queue.try_push(4) || queue.size_approx() != 4)
+            {
+                std::cerr << "[MpmcQueueCapacity] Full queue accepted an element\n";
+                return false;
+            }
+
+            for (int i = 0; i < 4; ++i)
+            {
+                int value = -1;
+                if (!queue.try_pop(value) || value != i)
+                {
+                    std::cerr << "[MpmcQueueCapacity] FIFO order broken at " << i << '\n';
+                    return false;
+                }
+            }
+
+            int value = -1;
+            if (queue.try_pop(value))
+            {
+                std::cerr << "[MpmcQueueCapacity] Empty queue returned an element\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool test_mpmc_queue_bulk()
+    {
+        vms::core::MpmcQueue<int> queue(8);
+
+        const std::array<int, 5> first{0, 1, 2, 3, 4};
+        const std::array<int, 5> second{5, 6, 7, 8, 9};
+
+        if (queue.try_push_n(first) != 5 || queue.try_push_n(second) != 3)
+        {
+            std::cerr << "[MpmcQueueBulk] Bulk push should stop at capacity\n";
+            return false;
+        }
+
+        std::array<int, 6> out{};
+        if (queue.try_pop_n(out) != 6)
+        {
+            std::cerr << "[MpmcQueueBulk] Bulk pop returned too few elements\n";
+            return false;
+        }
+
+        for (int i = 0; i < 6; ++i)
+        {
+            if (out[i] != i)
+            {
+                std::cerr << "[MpmcQueueBulk] Order broken at " << i << '\n';
+                return false;
+            }
+        }
+
+        if (queue.try_pop_n(out) != 2 || out[0] != 6 || out[1] != 7)
+        {
+            std::cerr << "[MpmcQueueBulk] Remaining elements not returned\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_mpmc_queue_destroys_elements()
+    {
+        auto tracker = std::make_shared<int>(0);
+
+        {
+            vms::core::MpmcQueue<std::shared_ptr<int>> queue(4);
+            queue.try_push(tracker);
+            queue.try_emplace(tracker);
+        }
+
+        if (tracker.use_count() != 1)
+        {
+            std::cerr << "[MpmcQueueDestroy] Remaining elements leaked: " << tracker.use_count() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_mpmc_queue_many_threads()
+    {
+        constexpr int producer_count = 4;
+        constexpr int consumer_count = 4;
+        constexpr uint64_t items_per_producer = 50000;
+        constexpr uint64_t total_items = producer_count * items_per_producer;
+
+        vms::core::MpmcQueue<uint64_t> queue(256);
+        std::vector<std::atomic<uint8_t>> seen(total_items);
+        std::atomic<uint64_t> consumed{0};
+        std::atomic<bool> duplicate{false};
+
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < producer_count; ++p)
+        {
+            threads.emplace_back([&, p]() {
+                const uint64_t base = static_cast<uint64_t>(p) * items_per_producer;
+                std::array<uint64_t, 8> batch{};
+
+                for (uint64_t i = 0; i < items_per_producer;)
+                {
+                    // Alternate single and bulk pushes to exercise both paths.
+                    size_t pushed = 0;
+
+                    if ((i / 8) % 2 == 0)
+                    {
+                        pushed = queue.try_push(base + i) ? 1 : 0;
+                    }
+                    else
+                    {
+                        const size_t count = static_cast<size_t>(std::min<uint64_t>(batch.size(), items_per_producer - i));
+                        for (size_t k = 0; k < count; ++k)
+                        {
+                            batch[k] = base + i + k;
+                        }
+
+                        pushed = queue.try_push_n(std::span<const uint64_t>(batch.data(), count));
+                    }
+
+                    if (pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    i += pushed;
+                }
+            });
+        }
+
+        for (int c = 0; c < consumer_count; ++c)
+        {
+            threads.emplace_back([&, c]() {
+                std::array<uint64_t, 8> batch{};
+
+                while (consumed.load(std::memory_order_relaxed) < total_items)
+                {
+                    size_t popped = 0;
+
+                    if (c % 2 == 0)
+                    {
+                        popped = queue.try_pop(batch[0]) ? 1 : 0;
+                    }
+                    else
+                    {
+                        popped = queue.try_pop_n(batch);
+                    }
+
+                    if (popped == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    for (size_t k = 0; k < popped; ++k)
+                    {
+                        if (seen[batch[k]].fetch_add(1, std::memory_order_relaxed) != 0)
+                        {
+                            duplicate.store(true, std::memory_order_relaxed);
+                        }
+                    }
+
+                    consumed.fetch_add(popped, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (duplicate.load() || consumed.load() != total_items)
+        {
+            std::cerr << "[MpmcQueueThreads] Elements lost or duplicated: consumed "
+                      << consumed.load() << " of " << total_items << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"MpmcQueue capacity", &test_mpmc_queue_capacity},
+        {"MpmcQueue bulk", &test_mpmc_queue_bulk},
+        {"MpmcQueue element destruction", &test_mpmc_queue_destroys_elements},
+        {"MpmcQueue many threads", &test_mpmc_queue_many_threads},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+#include <vms/core/seqlock.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /** @brief Every field holds the same counter: a torn copy shows mixed values. */
+    template <std::size_t Fields>
+    struct Snapshot
+    {
+        std::array<uint64_t, Fields> fields{};
+
+        void fill(uint64_t value)
+        {
+            fields.fill(value);
+        }
+
+        bool consistent() const
+        {
+            for (const uint64_t field : fields)
+            {
+                if (field != fields[0])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    /** @brief 13 bytes: exercises the partial last storage word. */
+    struct Odd
+    {
+        uint32_t a;
+        uint8_t b[9];
+    };
+
+    template <typename Lock, std::size_t Fields>
+    bool check_concurrent(const char* tag, uint64_t stores, int readers)
+    {
+        Lock lock;
+        std::atomic<bool> done{false};
+        std::atomic<int> failures{0};
+        std::atomic<uint64_t> reads{0};
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < readers; ++i)
+        {
+            threads.emplace_back([&] {
+                uint64_t previous = 0;
+
+                while (!done.load(std::memory_order_acquire))
+                {
+                    const Snapshot<Fields> snapshot = lock.load();
+
+                    if (!snapshot.consistent() || snapshot.fields[0] < previous)
+                    {
+                        failures.fetch_add(1);
+                    }
+
+                    previous = snapshot.fields[0];
+                    reads.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        Snapshot<Fields> value;
+
+        for (uint64_t i = 1; i <= stores; ++i)
+        {
+            value.fill(i);
+            lock.store(value);
+
+            if ((i & 255) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        done.store(true, std::memory_order_release);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const Snapshot<Fields> last = lock.load();
+
+        if (failures.load() != 0 || last.fields[0] != stores || lock.version() != stores || reads.load() == 0)
+        {
+            std::cerr << "[" << tag << "] " << failures.load() << " torn or stale reads out of " << reads.load()
+                      << ", version " << lock.version() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_seqlock_basic()
+    {
+        vms::core::Seqlock<Odd> lock(Odd{7, {1, 2, 3, 4, 5, 6, 7, 8, 9}});
+
+        Odd out{};
+        if (!lock.try_load(out) || out.a != 7 || out.b[8] != 9 || lock.version() != 0)
+        {
+            std::cerr << "[Seqlock] Initial value not published\n";
+            return false;
+        }
+
+        lock.store(Odd{42, {9, 8, 7, 6, 5, 4, 3, 2, 1}});
+        out = lock.load();
+
+        if (out.a != 42 || out.b[0] != 9 || out.b[8] != 1 || lock.version() != 1)
+        {
+            std::cerr << "[Seqlock] Stored value not read back\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_multi_slot_seqlock_basic()
+    {
+        vms::core::MultiSlotSeqlock<uint64_t, 3> lock(5);
+
+        if (lock.load() != 5 || lock.version() != 0)
+        {
+            std::cerr << "[MultiSlotSeqlock] Initial value not published\n";
+            return false;
+        }
+
+        // Wrap around the slots a few times.
+        for (uint64_t i = 1; i <= 10; ++i)
+        {
+            lock.store(i * 100);
+
+            uint64_t out = 0;
+            if (!lock.try_load(out) || out != i * 100 || lock.version() != i)
+            {
+                std::cerr << "[MultiSlotSeqlock] Store " << i << " not read back\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool test_seqlock_concurrent()
+    {
+        return check_concurrent<vms::core::Seqlock<Snapshot<16>>, 16>("SeqlockConcurrent", 200000, 2);
+    }
+
+    bool test_multi_slot_seqlock_concurrent()
+    {
+        return check_concurrent<vms::core::MultiSlotSeqlock<Snapshot<512>>, 512>("MultiSlotSeqlockConcurrent",
+                                                                                 50000, 2);
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"Seqlock basic", &test_seqlock_basic},
+        {"MultiSlotSeqlock basic", &test_multi_slot_seqlock_basic},
+        {"Seqlock concurrent readers", &test_seqlock_concurrent},
+        {"MultiSlotSeqlock concurrent readers", &test_multi_slot_seqlock_concurrent},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+#include <vms/core/spsc_ring.h>
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    bool test_spsc_ring_capacity()
+    {
+        vms::core::SpscRing<int> ring(5);
+
+        if (ring.capacity() != 8)
+        {
+            std::cerr << "[SpscRingCapacity] Expected capacity 8, got " << ring.capacity() << '\n';
+            return false;
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+            if (!ring.try_push(i))
+            {
+                std::cerr << "[SpscRingCapacity] Push " << i << " rejected before full\n";
+                return false;
+            }
+        }
+
+        if (ring.try_push(8) || ring.size() != 8)
+        {
+            std::cerr << "[SpscRingCapacity] Full ring accepted an element\n";
+            return false;
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+            int value = -1;
+            if (!ring.try_pop(value) || value != i)
+            {
+                std::cerr << "[SpscRingCapacity] FIFO order broken at " << i << '\n';
+                return false;
+            }
+        }
+
+        int value = -1;
+        if (ring.try_pop(value) || !ring.empty())
+        {
+            std::cerr << "[SpscRingCapacity] Empty ring returned an element\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_spsc_ring_batch_wraparound()
+    {
+        vms::core::SpscRing<int> ring(8);
+        int next_in = 0;
+        int next_out = 0;
+
+        // Offsets the indices so that batches straddle the end of the buffer.
+        for (int round = 0; round < 20; ++round)
+        {
+            std::array<int, 6> in{};
+            for (auto& item : in)
+            {
+                item = next_in++;
+            }
+
+            if (ring.try_push_n(in) != in.size())
+            {
+                std::cerr << "[SpscRingBatch] Batch push truncated on round " << round << '\n';
+                return false;
+            }
+
+            std::array<int, 8> out{};
+            const size_t popped = ring.try_pop_n(out);
+
+            if (popped != in.size())
+            {
+                std::cerr << "[SpscRingBatch] Batch pop returned " << popped << " elements\n";
+                return false;
+            }
+
+            for (size_t i = 0; i < popped; ++i)
+            {
+                if (out[i] != next_out++)
+                {
+                    std::cerr << "[SpscRingBatch] Order broken on round " << round << '\n';
+                    return false;
+                }
+            }
+        }
+
+        std::array<int, 12> too_many{};
+        if (ring.try_push_n(too_many) != ring.capacity())
+        {
+            std::cerr << "[SpscRingBatch] Oversized batch should fill the ring exactly\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_spsc_ring_destroys_elements()
+    {
+        auto tracker = std::make_shared<int>(0);
+
+        {
+            vms::core::SpscRing<std::shared_ptr<int>> ring(4);
+            ring.try_push(tracker);
+            ring.try_push(tracker);
+            ring.try_emplace(tracker);
+
+            std::shared_ptr<int> out;
+            ring.try_pop(out);
+            out.reset();
+
+            if (tracker.use_count() != 3)
+            {
+                std::cerr << "[SpscRingDestroy] Popped slot still holds a reference\n";
+                return false;
+            }
+        }
+
+        if (tracker.use_count() != 1)
+        {
+            std::cerr << "[SpscRingDestroy] Remaining elements leaked: " << tracker.use_count() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_spsc_ring_two_threads()
+    {
+        constexpr uint64_t item_count = 200000;
+
+        vms::core::SpscRing<uint64_t> ring(64);
+
+        std::thread producer([&]() {
+            for (uint64_t i = 0; i < item_count;)
+            {
+                if (ring.try_push(i))
+                {
+                    ++i;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        bool ordered = true;
+        uint64_t expected = 0;
+        std::array<uint64_t, 16> batch{};
+
+        while (expected < item_count)
+        {
+            const size_t popped = ring.try_pop_n(batch);
+
+            if (popped == 0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            for (size_t i = 0; i < popped; ++i)
+            {
+                ordered = ordered && (batch[i] == expected);
+                ++expected;
+            }
+        }
+
+        producer.join();
+
+        if (!ordered)
+        {
+            std::cerr << "[SpscRingThreads] Elements received out of order\n";
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"SpscRing capacity", &test_spsc_ring_capacity},
+        {"SpscRing batch wraparound", &test_spsc_ring_batch_wraparound},
+        {"SpscRing element destruction", &test_spsc_ring_destroys_elements},
+        {"SpscRing two threads", &test_spsc_ring_two_threads},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,321 @@
+#include <vms/core/thread_pool.h>
+#include <vms/core/work_stealing_deque.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    bool test_work_stealing_deque_order()
+    {
+        int values[4] = {0, 1, 2, 3};
+        vms::core::WorkStealingDeque<int> deque(3);
+
+        if (deque.capacity() != 4)
+        {
+            std::cerr << "[WorkStealingDequeOrder] Expected capacity 4, got " << deque.capacity() << '\n';
+            return false;
+        }
+
+        for (int& value : values)
+        {
+            if (!deque.push(&value))
+            {
+                std::cerr << "[WorkStealingDequeOrder] Push rejected before full\n";
+                return false;
+            }
+        }
+
+        if (deque.push(&values[0]) || deque.size_approx() != 4)
+        {
+            std::cerr << "[WorkStealingDequeOrder] Full deque accepted an element\n";
+            return false;
+        }
+
+        // Owner pops LIFO, thieves steal FIFO.
+        if (deque.steal() != &values[0] || deque.pop() != &values[3] ||
+            deque.steal() != &values[1] || deque.pop() != &values[2])
+        {
+            std::cerr << "[WorkStealingDequeOrder] Unexpected element order\n";
+            return false;
+        }
+
+        if (deque.pop() != nullptr || deque.steal() != nullptr)
+        {
+            std::cerr << "[WorkStealingDequeOrder] Empty deque returned an element\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_work_stealing_deque_concurrent()
+    {
+        constexpr int total_items = 200000;
+        constexpr int thief_count = 3;
+
+        std::vector<int> items(total_items);
+        std::vector<std::atomic<int>> seen(total_items);
+        vms::core::WorkStealingDeque<int> deque(64);
+        std::atomic<bool> done{false};
+        std::atomic<int> taken{0};
+
+        auto consume = [&](int* item) {
+            seen[static_cast<std::size_t>(item - items.data())].fetch_add(1, std::memory_order_relaxed);
+            taken.fetch_add(1, std::memory_order_relaxed);
+        };
+
+        std::vector<std::thread> thieves;
+
+        for (int t = 0; t < thief_count; ++t)
+        {
+            thieves.emplace_back([&] {
+                while (!done.load(std::memory_order_acquire))
+                {
+                    if (int* item = deque.steal())
+                    {
+                        consume(item);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (int i = 0; i < total_items; ++i)
+        {
+            while (!deque.push(&items[static_cast<std::size_t>(i)]))
+            {
+                if (int* item = deque.pop())
+                {
+                    consume(item);
+                }
+            }
+
+            if ((i & 3) == 0)
+            {
+                if (int* item = deque.pop())
+                {
+                    consume(item);
+                }
+            }
+        }
+
+        while (int* item = deque.pop())
+        {
+            consume(item);
+        }
+
+        done.store(true, std::memory_order_release);
+
+        for (auto& thief : thieves)
+        {
+            thief.join();
+        }
+
+        if (taken.load() != total_items)
+        {
+            std::cerr << "[WorkStealingDequeConcurrent] Took " << taken.load() << " of " << total_items << '\n';
+            return false;
+        }
+
+        for (const auto& count : seen)
+        {
+            if (count.load() != 1)
+            {
+                std::cerr << "[WorkStealingDequeConcurrent] Element taken " << count.load() << " times\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool test_thread_pool_results()
+    {
+        vms::core::ThreadPool pool(2);
+
+        if (pool.size() != 2 || !pool.start() || pool.start())
+        {
+            std::cerr << "[ThreadPoolResults] Unexpected size or start result\n";
+            return false;
+        }
+
+        auto answer = pool.submit([] { return 42; });
+        std::atomic<bool> ran{false};
+        auto side_effect = pool.submit([&ran] { ran.store(true); });
+        auto failing = pool.submit([]() -> int { throw std::runtime_error("task failure"); });
+
+        if (!answer.valid() || answer.get() != 42 || answer.valid())
+        {
+            std::cerr << "[ThreadPoolResults] Wrong result or handle still valid after get\n";
+            return false;
+        }
+
+        if (!side_effect.wait_for(std::chrono::seconds(5)) || !side_effect.ready() || !ran.load())
+        {
+            std::cerr << "[ThreadPoolResults] Void task did not complete\n";
+            return false;
+        }
+
+        side_effect.get();
+
+        try
+        {
+            failing.get();
+            std::cerr << "[ThreadPoolResults] Exception was not propagated\n";
+            return false;
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+
+        pool.stop();
+        return true;
+    }
+
+    /** @brief Recursive fan-out exercising local pushes and stealing. */
+    int64_t parallel_sum(vms::core::ThreadPool& pool, int64_t lo, int64_t hi)
+    {
+        if (hi - lo <= 64)
+        {
+            int64_t sum = 0;
+
+            for (int64_t i = lo; i < hi; ++i)
+            {
+                sum += i;
+            }
+
+            return sum;
+        }
+
+        const int64_t mid = lo + (hi - lo) / 2;
+        auto left = pool.submit([&pool, lo, mid] { return parallel_sum(pool, lo, mid); });
+        const int64_t right = parallel_sum(pool, mid, hi);
+        return left.get() + right;
+    }
+
+    bool test_thread_pool_nested_submit()
+    {
+        vms::core::ThreadPool pool(4, 256);
+        pool.start();
+
+        constexpr int64_t n = 1 << 16;
+        auto total = pool.submit([&pool] { return parallel_sum(pool, 0, n); });
+
+        const int64_t expected = n * (n - 1) / 2;
+        const int64_t actual = total.get();
+
+        if (actual != expected)
+        {
+            std::cerr << "[ThreadPoolNestedSubmit] Expected " << expected << ", got " << actual << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_pool_many_tasks()
+    {
+        constexpr int total_tasks = 50000;
+
+        vms::core::ThreadPool pool(3, 64);
+        pool.start();
+
+        std::atomic<int> executed{0};
+        std::vector<vms::core::TaskFuture<void>> futures;
+        futures.reserve(total_tasks);
+
+        for (int i = 0; i < total_tasks; ++i)
+        {
+            futures.push_back(pool.submit([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }));
+        }
+
+        for (auto& future : futures)
+        {
+            future.wait();
+        }
+
+        if (executed.load() != total_tasks)
+        {
+            std::cerr << "[ThreadPoolManyTasks] Executed " << executed.load() << " of " << total_tasks << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_pool_stop_drains()
+    {
+        vms::core::ThreadPool pool(2);
+        std::atomic<int> executed{0};
+
+        // Submitted before start: queued, then run either by the workers or by stop().
+        auto queued = pool.submit([&executed] { executed.fetch_add(1); return 7; });
+        pool.stop();
+
+        if (!queued.ready() || queued.get() != 7 || executed.load() != 1)
+        {
+            std::cerr << "[ThreadPoolStopDrains] Queued task not run by stop()\n";
+            return false;
+        }
+
+        if (!pool.start())
+        {
+            std::cerr << "[ThreadPoolStopDrains] Restart failed\n";
+            return false;
+        }
+
+        auto after_restart = pool.submit([] { return 8; });
+
+        if (after_restart.get() != 8)
+        {
+            std::cerr << "[ThreadPoolStopDrains] Task after restart failed\n";
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"WorkStealingDeque order", &test_work_stealing_deque_order},
+        {"WorkStealingDeque concurrent", &test_work_stealing_deque_concurrent},
+        {"ThreadPool results", &test_thread_pool_results},
+        {"ThreadPool nested submit", &test_thread_pool_nested_submit},
+        {"ThreadPool many tasks", &test_thread_pool_many_tasks},
+        {"ThreadPool stop drains", &test_thread_pool_stop_drains},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -1,9 +1,16 @@
+#include <vms/core/static_thread.h>
+#include <vms/core/thread_registry.h>
 #include <vms/core/thread_worker.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <chrono>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <unistd.h>
 #include <sched.h>
 #include <thread>
 #include <vector>
@@ -169,6 +176,960 @@ namespace
         std::atomic<bool> done_{false};
     };
 
+    class OverrunningHiResThread : public vms::core::HiResTimedThread
+    {
+    public:
+        OverrunningHiResThread(int32_t microseconds, size_t target_iterations, size_t overrun_at,
+                               std::chrono::microseconds overrun)
+            : vms::core::HiResTimedThread(microseconds)
+            , target_iterations_(target_iterations)
+            , overrun_at_(overrun_at)
+            , overrun_(overrun)
+        {
+            contexts_.reserve(target_iterations);
+        }
+
+        void run() override
+        {
+            contexts_.push_back(iteration_context());
+
+            if (contexts_.size() == overrun_at_)
+            {
+                std::this_thread::sleep_for(overrun_);
+            }
+
+            if (contexts_.size() >= target_iterations_)
+            {
+                done_.store(true, std::memory_order_release);
+                stop(false);
+            }
+        }
+
+        void on_overrun(const vms::core::IterationContext& /*context*/) override
+        {
+            overrun_callbacks_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool finished() const { return done_.load(std::memory_order_acquire); }
+        const std::vector<vms::core::IterationContext>& contexts() const { return contexts_; }
+        int overrun_callbacks() const { return overrun_callbacks_.load(std::memory_order_relaxed); }
+
+    private:
+        const size_t target_iterations_;
+        const size_t overrun_at_;
+        std::atomic<int> overrun_callbacks_{0};
+        const std::chrono::microseconds overrun_;
+        std::vector<vms::core::IterationContext> contexts_;
+        std::atomic<bool> done_{false};
+    };
+
+    class GatedEventThread : public vms::core::EventThread
+    {
+    public:
+        void run() override
+        {
+            run_calls_.fetch_add(1, std::memory_order_release);
+
+            while (gate_closed_.load(std::memory_order_acquire))
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+
+        void close_gate() { gate_closed_.store(true, std::memory_order_release); }
+        void open_gate() { gate_closed_.store(false, std::memory_order_release); }
+        int run_calls() const { return run_calls_.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<int> run_calls_{0};
+        std::atomic<bool> gate_closed_{false};
+    };
+
+    class CounterPollingThread : public vms::core::PollingThread
+    {
+    public:
+        explicit CounterPollingThread(const vms::core::IdleConfig& config)
+            : vms::core::PollingThread(config)
+        {
+        }
+
+        void submit(int items)
+        {
+            pending_.fetch_add(items, std::memory_order_release);
+            notify();
+        }
+
+        bool poll() override
+        {
+            poll_calls_.fetch_add(1, std::memory_order_relaxed);
+
+            if (pending_.load(std::memory_order_acquire) == 0)
+            {
+                return false;
+            }
+
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+            processed_.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+
+        int processed() const { return processed_.load(std::memory_order_acquire); }
+        uint64_t poll_calls() const { return poll_calls_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int> pending_{0};
+        std::atomic<int> processed_{0};
+        std::atomic<uint64_t> poll_calls_{0};
+    };
+
+    class CounterBatchedThread : public vms::core::BatchedThread
+    {
+    public:
+        explicit CounterBatchedThread(std::size_t batch_size)
+            : vms::core::BatchedThread(batch_size)
+        {
+        }
+
+        void submit(int items)
+        {
+            pending_.fetch_add(items, std::memory_order_release);
+            notify();
+        }
+
+        std::size_t run_batch(std::size_t budget) override
+        {
+            const int available = pending_.load(std::memory_order_acquire);
+            const int taken = std::min(available, static_cast<int>(budget));
+
+            if (taken > largest_batch_.load(std::memory_order_relaxed))
+            {
+                largest_batch_.store(taken, std::memory_order_relaxed);
+            }
+
+            pending_.fetch_sub(taken, std::memory_order_acq_rel);
+            return static_cast<std::size_t>(taken);
+        }
+
+        int largest_batch() const { return largest_batch_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int> pending_{0};
+        std::atomic<int> largest_batch_{0};
+    };
+
+    class CounterStaticThread : public vms::core::StaticThread<CounterStaticThread>
+    {
+        friend struct vms::core::StaticThreadAccess;
+
+    public:
+        ~CounterStaticThread()
+        {
+            stop();
+        }
+
+        int init_calls() const { return init_calls_.load(); }
+        int uninit_calls() const { return uninit_calls_.load(); }
+        uint64_t iterations() const { return iterations_.load(); }
+
+    private:
+        bool init()
+        {
+            init_calls_.fetch_add(1);
+            return true;
+        }
+
+        void uninit()
+        {
+            uninit_calls_.fetch_add(1);
+        }
+
+        void run()
+        {
+            iterations_.fetch_add(1, std::memory_order_relaxed);
+
+            if ((iterations_.load(std::memory_order_relaxed) & 1023) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        std::atomic<int> init_calls_{0};
+        std::atomic<int> uninit_calls_{0};
+        std::atomic<uint64_t> iterations_{0};
+    };
+
+    class TickingStaticThread
+        : public vms::core::StaticHiResTimed<vms::core::StaticThread<TickingStaticThread>>
+    {
+    public:
+        explicit TickingStaticThread(int32_t micro_sec) : StaticHiResTimed(micro_sec) {}
+
+        ~TickingStaticThread()
+        {
+            stop();
+        }
+
+        void run()
+        {
+            ticks_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        int ticks() const { return ticks_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int> ticks_{0};
+    };
+
+    class SleepyStaticThread : public vms::core::StaticTimed<vms::core::StaticThread<SleepyStaticThread>>
+    {
+        friend struct vms::core::StaticThreadAccess;
+
+    public:
+        explicit SleepyStaticThread(bool init_result) : StaticTimed(10000000), init_result_(init_result) {}
+
+        ~SleepyStaticThread()
+        {
+            stop();
+        }
+
+    private:
+        bool init() { return init_result_; }
+        void run() {}
+
+        bool init_result_;
+    };
+
+    class WaitingStaticThread : public vms::core::StaticThread<WaitingStaticThread>
+    {
+        friend struct vms::core::StaticThreadAccess;
+
+    public:
+        ~WaitingStaticThread()
+        {
+            stop();
+        }
+
+        int wakes() const { return wakes_.load(); }
+
+    private:
+        void run()
+        {
+            wait_for_wake();
+            wakes_.fetch_add(1);
+        }
+
+        std::atomic<int> wakes_{0};
+    };
+
+    /** @brief Hook ported from a Thread subclass without the friend declaration. */
+    class UnreachableInitStaticThread : public vms::core::StaticThread<UnreachableInitStaticThread>
+    {
+    public:
+        void run() {}
+
+    protected:
+        bool init() { return true; }
+    };
+
+    // StaticThread::loop() static_asserts on exactly this combination.
+    static_assert(vms::core::detail::DeclaresInit<UnreachableInitStaticThread>
+                  && !vms::core::detail::StaticInitHook<UnreachableInitStaticThread>);
+    static_assert(vms::core::detail::DeclaresInit<CounterStaticThread>
+                  && vms::core::detail::StaticInitHook<CounterStaticThread>);
+    static_assert(!vms::core::detail::DeclaresPreRun<CounterStaticThread>);
+    static_assert(vms::core::detail::DeclaresPreRun<SleepyStaticThread>
+                  && vms::core::detail::StaticPreRunHook<SleepyStaticThread>);
+
+    template <typename Base>
+    class CountingThread : public Base
+    {
+    public:
+        explicit CountingThread(int32_t microseconds)
+            : Base(microseconds)
+        {
+        }
+
+        void run() override
+        {
+            run_calls_.fetch_add(1, std::memory_order_release);
+        }
+
+        int run_calls() const { return run_calls_.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<int> run_calls_{0};
+    };
+
+    template <typename Base>
+    bool check_stop_latency(const char* tag)
+    {
+        constexpr int32_t period_us = 1000000; // 1s period
+        constexpr auto max_latency = std::chrono::milliseconds(100);
+
+        CountingThread<Base> worker(period_us);
+
+        if (!worker.start())
+        {
+            std::cerr << tag << " Unable to start worker\n";
+            return false;
+        }
+
+        // Let the worker settle into its sleep.
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        const auto begin = TestClock::now();
+        worker.stop();
+        const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+            TestClock::now() - begin);
+
+        if (latency > max_latency)
+        {
+            std::cerr << tag << " stop() took " << latency.count() << "ms with a 1s period\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_timed_thread_stop_latency()
+    {
+        return check_stop_latency<vms::core::TimedThread>("[TimedThreadStop]");
+    }
+
+    bool test_hires_timed_thread_stop_latency()
+    {
+        return check_stop_latency<vms::core::HiResTimedThread>("[HiResTimedThreadStop]");
+    }
+
+    bool test_hires_timed_thread_hybrid_precision()
+    {
+        constexpr int32_t period_us = 2000; // 2ms loop period
+        constexpr size_t iterations = 20;
+        constexpr auto expected = std::chrono::microseconds(period_us);
+        constexpr auto tolerance = std::chrono::microseconds(1000);
+
+        RecordingHiResThread worker(period_us, iterations);
+        worker.set_precision(vms::core::TimerPrecision::HYBRID);
+
+        if (worker.precision() != vms::core::TimerPrecision::HYBRID)
+        {
+            std::cerr << "[HiResHybrid] Precision mode not stored\n";
+            return false;
+        }
+
+        if (!worker.start())
+        {
+            std::cerr << "[HiResHybrid] Unable to start worker\n";
+            return false;
+        }
+
+        const bool finished = wait_for_condition(
+            [&]() { return worker.finished(); }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!finished)
+        {
+            std::cerr << "[HiResHybrid] Worker did not complete in time\n";
+            return false;
+        }
+
+        const auto margin = worker.spin_margin();
+        if (margin <= std::chrono::nanoseconds::zero() || margin > expected)
+        {
+            std::cerr << "[HiResHybrid] Spin margin out of range: " << margin.count() << "ns\n";
+            return false;
+        }
+
+        const auto& timestamps = worker.timestamps();
+        const auto average = std::chrono::duration_cast<std::chrono::microseconds>(
+            (timestamps.back() - timestamps.front()) / static_cast<int>(timestamps.size() - 1));
+
+        const auto delta = (average > expected) ? (average - expected) : (expected - average);
+        if (delta > tolerance)
+        {
+            std::cerr << "[HiResHybrid] Average period " << average.count()
+                      << "us (expected " << expected.count() << "us)\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_hires_timed_thread_timerfd_interval()
+    {
+        constexpr int32_t period_us = 5000; // 5ms loop period
+        constexpr auto expected = std::chrono::microseconds(period_us);
+        constexpr auto tolerance = std::chrono::microseconds(2000);
+
+        RecordingHiResThread worker(period_us, 6);
+        worker.set_backend(vms::core::TimerBackend::TIMERFD);
+
+        if (!worker.start())
+        {
+            std::cerr << "[HiResTimerfd] Unable to start worker\n";
+            return false;
+        }
+
+        const bool finished = wait_for_condition(
+            [&]() { return worker.finished(); }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!finished)
+        {
+            std::cerr << "[HiResTimerfd] Worker did not complete in time\n";
+            return false;
+        }
+
+        if (worker.backend() != vms::core::TimerBackend::TIMERFD)
+        {
+            std::cerr << "[HiResTimerfd] Worker fell back to the steady clock backend\n";
+            return false;
+        }
+
+        const auto& timestamps = worker.timestamps();
+        for (size_t i = 1; i < timestamps.size(); ++i)
+        {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                timestamps[i] - timestamps[i - 1]);
+
+            const auto delta = (elapsed > expected) ? (elapsed - expected) : (expected - elapsed);
+
+            if (delta > tolerance)
+            {
+                std::cerr << "[HiResTimerfd] Interval deviation too large: "
+                          << elapsed.count() << "us (expected " << expected.count() << "us)\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool check_missed_ticks(vms::core::TimerBackend backend, const char* tag)
+    {
+        constexpr int32_t period_us = 5000; // 5ms loop period
+        constexpr size_t overrun_at = 3;
+
+        // Overrunning by 3.5 periods skips 2 to 3 slots depending on the backend phase.
+        OverrunningHiResThread worker(period_us, 6, overrun_at, std::chrono::microseconds(17500));
+        worker.set_backend(backend);
+
+        if (!worker.start())
+        {
+            std::cerr << tag << " Unable to start worker\n";
+            return false;
+        }
+
+        const bool finished = wait_for_condition(
+            [&]() { return worker.finished(); }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!finished)
+        {
+            std::cerr << tag << " Worker did not complete in time\n";
+            return false;
+        }
+
+        const auto& contexts = worker.contexts();
+        for (size_t i = 0; i < contexts.size(); ++i)
+        {
+            if (contexts[i].index != i)
+            {
+                std::cerr << tag << " Unexpected iteration index " << contexts[i].index << '\n';
+                return false;
+            }
+        }
+
+        const uint64_t missed = contexts[overrun_at].missed_ticks;
+        if (missed < 2 || missed > 4)
+        {
+            std::cerr << tag << " Expected the overrun to be reported, got "
+                      << missed << " missed ticks\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_hires_timed_thread_missed_ticks()
+    {
+        return check_missed_ticks(vms::core::TimerBackend::STEADY_CLOCK, "[HiResMissedTicks]")
+            && check_missed_ticks(vms::core::TimerBackend::TIMERFD, "[HiResTimerfdMissedTicks]");
+    }
+
+    bool check_overrun_policy(vms::core::TimerBackend backend, vms::core::OverrunPolicy policy,
+                              uint64_t min_missed, uint64_t max_missed, const char* tag)
+    {
+        constexpr int32_t period_us = 5000; // 5ms loop period
+        constexpr auto interval = std::chrono::microseconds(period_us);
+        constexpr size_t overrun_at = 3;
+
+        OverrunningHiResThread worker(period_us, 7, overrun_at, std::chrono::microseconds(17500));
+        worker.set_backend(backend);
+        worker.set_overrun_policy(policy);
+        worker.set_catch_up_limit(1);
+
+        if (!worker.start())
+        {
+            std::cerr << tag << " Unable to start worker\n";
+            return false;
+        }
+
+        const bool finished = wait_for_condition(
+            [&]() { return worker.finished(); }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!finished)
+        {
+            std::cerr << tag << " Worker did not complete in time\n";
+            return false;
+        }
+
+        if (worker.overrun_count() < 1 || worker.overrun_callbacks() != static_cast<int>(worker.overrun_count()))
+        {
+            std::cerr << tag << " Overrun not reported: count " << worker.overrun_count()
+                      << ", callbacks " << worker.overrun_callbacks() << '\n';
+            return false;
+        }
+
+        const auto& contexts = worker.contexts();
+        for (const auto& context : contexts)
+        {
+            if ((context.deadline - contexts.front().deadline) % interval != std::chrono::steady_clock::duration::zero())
+            {
+                std::cerr << tag << " Iteration " << context.index << " left the deadline grid\n";
+                return false;
+            }
+        }
+
+        const uint64_t missed = contexts[overrun_at].missed_ticks;
+        if (missed < min_missed || missed > max_missed)
+        {
+            std::cerr << tag << " Unexpected missed ticks after the overrun: " << missed << '\n';
+            return false;
+        }
+
+        if (policy == vms::core::OverrunPolicy::CATCH_UP
+            && contexts[overrun_at + 1].deadline != contexts[overrun_at].deadline + interval)
+        {
+            std::cerr << tag << " Catch-up iteration did not follow the late one\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_hires_timed_thread_overrun_policies()
+    {
+        using vms::core::OverrunPolicy;
+        using vms::core::TimerBackend;
+
+        for (const auto backend : {TimerBackend::STEADY_CLOCK, TimerBackend::TIMERFD})
+        {
+            if (!check_overrun_policy(backend, OverrunPolicy::SKIP, 3, 5, "[HiResOverrunSkip]")
+                || !check_overrun_policy(backend, OverrunPolicy::CATCH_UP, 1, 3, "[HiResOverrunCatchUp]"))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool test_log_linear_buckets()
+    {
+        using Buckets = vms::core::LogLinearBuckets;
+
+        for (size_t idx = 0; idx < Buckets::BUCKET_COUNT; ++idx)
+        {
+            if (Buckets::index(Buckets::lower_bound(idx)) != idx
+                || Buckets::index(Buckets::upper_bound(idx)) != idx)
+            {
+                std::cerr << "[LogLinearBuckets] Bounds of bucket " << idx << " are inconsistent\n";
+                return false;
+            }
+
+            if (idx > 0 && Buckets::lower_bound(idx) != Buckets::upper_bound(idx - 1) + 1)
+            {
+                std::cerr << "[LogLinearBuckets] Gap between buckets " << idx - 1 << " and " << idx << '\n';
+                return false;
+            }
+        }
+
+        if (Buckets::index(UINT64_MAX) != Buckets::BUCKET_COUNT - 1)
+        {
+            std::cerr << "[LogLinearBuckets] Largest value does not map to the last bucket\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_hires_timed_thread_statistics()
+    {
+        constexpr int32_t period_us = 2000; // 2ms loop period
+        constexpr size_t iterations = 20;
+        constexpr double expected_ns = period_us * 1000.0;
+
+        RecordingHiResThread worker(period_us, iterations);
+        worker.enable_statistics();
+
+        if (!worker.start())
+        {
+            std::cerr << "[HiResStatistics] Unable to start worker\n";
+            return false;
+        }
+
+        const bool finished = wait_for_condition(
+            [&]() { return worker.finished(); }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!finished)
+        {
+            std::cerr << "[HiResStatistics] Worker did not complete in time\n";
+            return false;
+        }
+
+        const auto stats = worker.statistics();
+
+        if (stats.wakeup_latency.count != iterations || stats.period.count != iterations - 1
+            || stats.run_duration.count != iterations)
+        {
+            std::cerr << "[HiResStatistics] Unexpected sample counts: " << stats.wakeup_latency.count
+                      << '/' << stats.period.count << '/' << stats.run_duration.count << '\n';
+            return false;
+        }
+
+        if (stats.period.min > stats.period.max
+            || stats.period.mean() < expected_ns * 0.75 || stats.period.mean() > expected_ns * 1.25)
+        {
+            std::cerr << "[HiResStatistics] Period mean out of range: " << stats.period.mean() << "ns\n";
+            return false;
+        }
+
+        // run() of RecordingHiResThread sleeps 500us.
+        if (stats.run_duration.min < 500000)
+        {
+            std::cerr << "[HiResStatistics] run() duration too short: " << stats.run_duration.min << "ns\n";
+            return false;
+        }
+
+        uint64_t histogram_samples = 0;
+        for (const uint64_t count : stats.wakeup_histogram)
+        {
+            histogram_samples += count;
+        }
+
+        const uint64_t median = stats.wakeup_percentile(0.5);
+        if (histogram_samples != iterations || median > stats.wakeup_latency.max
+            || stats.wakeup_percentile(1.0) < stats.wakeup_latency.max)
+        {
+            std::cerr << "[HiResStatistics] Histogram does not match the summary\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_timed_thread_wake()
+    {
+        CountingThread<vms::core::TimedThread> worker(1000000);
+
+        if (!worker.start())
+        {
+            std::cerr << "[TimedThreadWake] Unable to start worker\n";
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        worker.wake();
+
+        const bool woken = wait_for_condition(
+            [&]() { return worker.run_calls() >= 1; }, std::chrono::milliseconds(200));
+
+        worker.stop();
+
+        if (!woken)
+        {
+            std::cerr << "[TimedThreadWake] wake() did not cut the sleep short\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_event_thread_notify()
+    {
+        GatedEventThread worker;
+
+        if (!worker.start())
+        {
+            std::cerr << "[EventThread] Unable to start worker\n";
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const int idle_runs = worker.run_calls();
+
+        // Hold the first run() while notifications pile up.
+        worker.close_gate();
+        worker.notify();
+
+        const bool first_run = wait_for_condition(
+            [&]() { return worker.run_calls() == 1; }, std::chrono::milliseconds(200));
+
+        for (int i = 0; i < 10; ++i)
+        {
+            worker.notify();
+        }
+
+        worker.open_gate();
+
+        const bool coalesced_run = wait_for_condition(
+            [&]() { return worker.run_calls() >= 2; }, std::chrono::milliseconds(200));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const int total_runs = worker.run_calls();
+
+        const auto begin = TestClock::now();
+        worker.stop();
+        const auto stop_latency = TestClock::now() - begin;
+
+        if (idle_runs != 0)
+        {
+            std::cerr << "[EventThread] run() invoked without notification\n";
+            return false;
+        }
+
+        if (!first_run || !coalesced_run || total_runs != 2)
+        {
+            std::cerr << "[EventThread] Expected 2 runs for 11 notifications, got " << total_runs << '\n';
+            return false;
+        }
+
+        if (stop_latency > std::chrono::milliseconds(100))
+        {
+            std::cerr << "[EventThread] stop() did not wake the idle worker\n";
+            return false;
+        }
+
+        if (worker.run_calls() != total_runs)
+        {
+            std::cerr << "[EventThread] stop() was followed by a spurious run()\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool check_idle_strategy(const vms::core::IdleConfig& config, bool expect_parked, const char* tag)
+    {
+        CounterPollingThread worker(config);
+
+        if (!worker.start())
+        {
+            std::cerr << tag << " Unable to start worker\n";
+            return false;
+        }
+
+        // Let the strategy escalate to its deepest idle level.
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        const uint64_t polls_before = worker.poll_calls();
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        const uint64_t idle_polls = worker.poll_calls() - polls_before;
+
+        worker.submit(100);
+
+        const bool processed = wait_for_condition(
+            [&]() { return worker.processed() == 100; }, std::chrono::milliseconds(200));
+
+        worker.stop();
+
+        if (!processed)
+        {
+            std::cerr << tag << " Work not processed after notify(): " << worker.processed() << '\n';
+            return false;
+        }
+
+        if (expect_parked && idle_polls != 0)
+        {
+            std::cerr << tag << " Parked worker kept polling: " << idle_polls << " polls\n";
+            return false;
+        }
+
+        if (!expect_parked && idle_polls == 0)
+        {
+            std::cerr << tag << " Worker stopped polling while idle\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_polling_thread_idle_strategies()
+    {
+        using vms::core::IdleStrategy;
+
+        vms::core::IdleConfig park;
+        park.strategy = IdleStrategy::SPIN_PARK;
+
+        vms::core::IdleConfig backoff;
+        backoff.strategy = IdleStrategy::BACKOFF;
+        backoff.max_backoff = std::chrono::microseconds(2000);
+
+        vms::core::IdleConfig spin_yield;
+        spin_yield.strategy = IdleStrategy::SPIN_YIELD;
+
+        return check_idle_strategy(park, true, "[PollingThreadPark]")
+            && check_idle_strategy(backoff, false, "[PollingThreadBackoff]")
+            && check_idle_strategy(spin_yield, false, "[PollingThreadSpinYield]");
+    }
+
+    bool test_batched_thread()
+    {
+        CounterBatchedThread worker(16);
+        worker.start();
+        worker.submit(1000);
+
+        const bool drained = wait_for_condition(
+            [&]() { return worker.processed_count() == 1000; }, std::chrono::milliseconds(1000));
+
+        worker.set_batch_size(0);
+        worker.submit(10);
+        const bool drained_again = wait_for_condition(
+            [&]() { return worker.processed_count() == 1010; }, std::chrono::milliseconds(1000));
+
+        worker.stop();
+
+        if (!drained || !drained_again)
+        {
+            std::cerr << "[BatchedThread] Processed " << worker.processed_count() << " of 1010 items\n";
+            return false;
+        }
+
+        if (worker.largest_batch() != 16 || worker.batch_size() != 1)
+        {
+            std::cerr << "[BatchedThread] Largest batch " << worker.largest_batch() << ", batch size "
+                      << worker.batch_size() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_static_thread()
+    {
+        CounterStaticThread worker;
+
+        if (!worker.start() || worker.start())
+        {
+            std::cerr << "[StaticThread] Unexpected start() result\n";
+            return false;
+        }
+
+        const bool ran = wait_for_condition(
+            [&]() { return worker.iterations() >= 10000; }, std::chrono::milliseconds(1000));
+        worker.stop();
+
+        const uint64_t stopped_at = worker.iterations();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        if (!ran || worker.iterations() != stopped_at || worker.init_calls() != 1 || worker.uninit_calls() != 1)
+        {
+            std::cerr << "[StaticThread] Loop or hooks misbehaved\n";
+            return false;
+        }
+
+        return worker.start();
+    }
+
+    bool test_static_thread_mixins()
+    {
+        using vms::core::ThreadState;
+
+        TickingStaticThread ticker(2000);
+        ticker.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const ThreadState running = ticker.state();
+        ticker.stop();
+
+        // 50 periods in 100 ms; generous bounds for a loaded single core.
+        if (running != ThreadState::RUNNING || ticker.state() != ThreadState::STOPPED || ticker.ticks() < 20
+            || ticker.ticks() > 60)
+        {
+            std::cerr << "[StaticThread] HiRes mixin ticked " << ticker.ticks() << " times in 100 ms\n";
+            return false;
+        }
+
+        SleepyStaticThread sleepy(true);
+        sleepy.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        const auto stop_begin = std::chrono::steady_clock::now();
+        sleepy.stop();
+        const auto stop_latency = std::chrono::steady_clock::now() - stop_begin;
+
+        if (stop_latency > std::chrono::milliseconds(500))
+        {
+            std::cerr << "[StaticThread] stop() did not interrupt the Timed mixin sleep\n";
+            return false;
+        }
+
+        SleepyStaticThread failing(false);
+        failing.start();
+
+        const bool failed = wait_for_condition(
+            [&]() { return failing.state() == ThreadState::FAILED_INIT; }, std::chrono::milliseconds(1000));
+
+        if (!failed || !failing.start())
+        {
+            std::cerr << "[StaticThread] Failed init not reported or not restartable\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_static_thread_join_handle()
+    {
+        WaitingStaticThread worker;
+        worker.start();
+
+        const auto handle = worker.join_handle();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        // wait_for_wake() has no deadline: only wake() lets an iteration through.
+        if (handle.done() || worker.wakes() != 0)
+        {
+            std::cerr << "[StaticThread] wait_for_wake() returned without a wake()\n";
+            return false;
+        }
+
+        worker.wake();
+
+        if (!wait_for_condition([&]() { return worker.wakes() >= 1; }, std::chrono::milliseconds(1000)))
+        {
+            std::cerr << "[StaticThread] wake() did not release wait_for_wake()\n";
+            return false;
+        }
+
+        const auto stopping = worker.request_stop();
+
+        if (!stopping.wait_for(std::chrono::seconds(1)) || !handle.done()
+            || worker.state() != vms::core::ThreadState::STOPPED)
+        {
+            std::cerr << "[StaticThread] JoinHandle not signalled on exit\n";
+            return false;
+        }
+
+        return true;
+    }
+
     bool test_thread_lifecycle()
     {
         LifecycleThread worker(5);
@@ -258,6 +1219,454 @@ namespace
         return true;
     }
 
+    /** @brief Worker whose uninit() takes a while, like flushing buffers on shutdown. */
+    class SlowUninitThread : public vms::core::Thread
+    {
+    public:
+        ~SlowUninitThread() override
+        {
+            stop();
+        }
+
+        void run() override
+        {
+            sleep_for(std::chrono::seconds(1));
+        }
+
+        void uninit() override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    };
+
+    /** @brief Worker spinning on an empty run(), stopped only from outside. */
+    class YieldingThread : public vms::core::Thread
+    {
+    public:
+        ~YieldingThread() override
+        {
+            stop();
+        }
+
+        void run() override
+        {
+            std::this_thread::yield();
+        }
+    };
+
+    bool test_thread_start_stop_race()
+    {
+        using vms::core::ThreadState;
+
+        YieldingThread worker;
+
+        for (int round = 0; round < 500; ++round)
+        {
+            std::atomic<bool> go{false};
+            std::thread stopper([&]()
+            {
+                while (!go.load())
+                {
+                    std::this_thread::yield();
+                }
+
+                worker.request_stop();
+            });
+
+            go.store(true);
+            worker.start();
+            stopper.join();
+
+            // A stop landing before start() is legitimately lost; one that
+            // moved the new run to STOPPING must end it.
+            if (worker.state() == ThreadState::STOPPING && !worker.join_handle().wait_for(std::chrono::seconds(1)))
+            {
+                std::cerr << "[ThreadStartStopRace] Stop lost in round " << round << '\n';
+                return false;
+            }
+
+            worker.stop();
+        }
+
+        return true;
+    }
+
+    bool test_thread_lifecycle_state()
+    {
+        using vms::core::ThreadState;
+
+        LifecycleThread worker(1000000);
+
+        if (worker.state() != ThreadState::IDLE || !worker.join_handle().done())
+        {
+            std::cerr << "[ThreadLifecycleState] New worker should be idle\n";
+            return false;
+        }
+
+        worker.start();
+
+        const bool running = wait_for_condition(
+            [&]() { return worker.state() == ThreadState::RUNNING; }, std::chrono::milliseconds(500));
+
+        const auto stop_begin = TestClock::now();
+        const auto handle = worker.request_stop();
+        const auto request_time = TestClock::now() - stop_begin;
+
+        const bool exited = handle.wait_for(std::chrono::seconds(2));
+        const ThreadState after_stop = worker.state();
+
+        // The exited loop is reaped by start(), no stop() needed in between.
+        const bool restarted = worker.start();
+        const bool running_again = wait_for_condition(
+            [&]() { return worker.state() == ThreadState::RUNNING; }, std::chrono::milliseconds(500));
+        worker.stop();
+
+        if (!running || !exited || after_stop != ThreadState::STOPPED || request_time > std::chrono::milliseconds(20))
+        {
+            std::cerr << "[ThreadLifecycleState] request_stop() did not lead to STOPPED promptly\n";
+            return false;
+        }
+
+        if (!restarted || !running_again || worker.state() != ThreadState::STOPPED)
+        {
+            std::cerr << "[ThreadLifecycleState] Restart after request_stop() failed\n";
+            return false;
+        }
+
+        FailingInitThread failing;
+        failing.start();
+
+        if (!failing.join_handle().wait_for(std::chrono::seconds(1)) || failing.state() != ThreadState::FAILED_INIT)
+        {
+            std::cerr << "[ThreadLifecycleState] Failed init not reported\n";
+            return false;
+        }
+
+        failing.stop();
+        return true;
+    }
+
+    bool test_thread_stop_all()
+    {
+        constexpr int worker_count = 16;
+
+        std::vector<std::unique_ptr<SlowUninitThread>> workers;
+        std::vector<vms::core::Thread*> threads;
+
+        for (int i = 0; i < worker_count; ++i)
+        {
+            workers.push_back(std::make_unique<SlowUninitThread>());
+            threads.push_back(workers.back().get());
+            workers.back()->start();
+        }
+
+        wait_for_condition([&]() {
+            for (const auto& worker : workers)
+            {
+                if (worker->state() != vms::core::ThreadState::RUNNING)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }, std::chrono::milliseconds(1000));
+
+        const auto begin = TestClock::now();
+        vms::core::Thread::stop_all(threads);
+        const auto elapsed = TestClock::now() - begin;
+
+        for (const auto& worker : workers)
+        {
+            if (worker->state() != vms::core::ThreadState::STOPPED)
+            {
+                std::cerr << "[ThreadStopAll] Worker not stopped\n";
+                return false;
+            }
+        }
+
+        // Joined one by one this would take worker_count * 100ms.
+        if (elapsed > std::chrono::milliseconds(800))
+        {
+            std::cerr << "[ThreadStopAll] Took "
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_affinity()
+    {
+        LifecycleThread worker(1000000);
+
+        cpu_set_t empty;
+        CPU_ZERO(&empty);
+
+        if (worker.set_affinity(empty))
+        {
+            std::cerr << "[ThreadAffinity] Empty mask should be rejected\n";
+            return false;
+        }
+
+        cpu_set_t mask;
+        if (worker.get_affinity(mask))
+        {
+            std::cerr << "[ThreadAffinity] No mask expected before configuration\n";
+            return false;
+        }
+
+        if (!worker.set_affinity(0))
+        {
+            std::cerr << "[ThreadAffinity] Unable to request CPU 0\n";
+            return false;
+        }
+
+        if (!worker.start())
+        {
+            std::cerr << "[ThreadAffinity] Unable to start worker\n";
+            return false;
+        }
+
+        const bool ran = wait_for_condition(
+            [&]() { return worker.run_calls() >= 2; }, std::chrono::milliseconds(500));
+
+        CPU_ZERO(&mask);
+        const bool queried = worker.get_affinity(mask);
+        const bool reapplied = worker.set_affinity(0);
+
+        worker.stop();
+
+        if (!ran)
+        {
+            std::cerr << "[ThreadAffinity] Worker did not run\n";
+            return false;
+        }
+
+        if (!queried || CPU_COUNT(&mask) != 1 || !CPU_ISSET(0, &mask))
+        {
+            std::cerr << "[ThreadAffinity] Effective mask does not match CPU 0\n";
+            return false;
+        }
+
+        if (!reapplied || worker.affinity_error() != 0)
+        {
+            std::cerr << "[ThreadAffinity] Runtime affinity change failed: "
+                      << worker.affinity_error() << '\n';
+            return false;
+        }
+
+        if (worker.last_cpu() != 0)
+        {
+            std::cerr << "[ThreadAffinity] Loop ran on CPU " << worker.last_cpu()
+                      << " instead of 0\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_scheduling()
+    {
+        LifecycleThread batch_worker(1000000);
+        LifecycleThread invalid_worker(1000000);
+
+        vms::core::ThreadScheduling batch;
+        batch.policy = vms::core::ThreadSchedulingPolicy::BATCH;
+        batch.nice = 5;
+
+        vms::core::ThreadScheduling invalid;
+        invalid.policy = vms::core::ThreadSchedulingPolicy::FIFO;
+        invalid.priority = sched_get_priority_max(SCHED_FIFO) + 1;
+
+        if (!batch_worker.set_scheduling(batch) || !invalid_worker.set_scheduling(invalid))
+        {
+            std::cerr << "[ThreadScheduling] Requests should be stored while idle\n";
+            return false;
+        }
+
+        if (!batch_worker.start() || !invalid_worker.start())
+        {
+            std::cerr << "[ThreadScheduling] Unable to start workers\n";
+            batch_worker.stop();
+            invalid_worker.stop();
+            return false;
+        }
+
+        const bool ran = wait_for_condition(
+            [&]() { return batch_worker.run_calls() >= 2 && invalid_worker.run_calls() >= 2; },
+            std::chrono::milliseconds(500));
+
+        vms::core::ThreadScheduling effective;
+        const bool queried = batch_worker.get_scheduling(effective);
+
+        batch_worker.stop();
+        invalid_worker.stop();
+
+        if (!ran)
+        {
+            std::cerr << "[ThreadScheduling] Workers did not run\n";
+            return false;
+        }
+
+        if (!queried || effective.policy != vms::core::ThreadSchedulingPolicy::BATCH
+            || effective.nice != 5 || batch_worker.scheduling_error() != 0)
+        {
+            std::cerr << "[ThreadScheduling] BATCH policy not applied to the worker\n";
+            return false;
+        }
+
+        if (invalid_worker.scheduling_error() == 0)
+        {
+            std::cerr << "[ThreadScheduling] Invalid priority should be reported\n";
+            return false;
+        }
+
+        const int process_policy = sched_getscheduler(0);
+        if (process_policy != SCHED_OTHER)
+        {
+            std::cerr << "[ThreadScheduling] Process policy changed to " << process_policy << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string read_thread_comm(pid_t tid)
+    {
+        std::ifstream comm("/proc/self/task/" + std::to_string(tid) + "/comm");
+        std::string name;
+        std::getline(comm, name);
+        return name;
+    }
+
+    bool test_thread_name()
+    {
+        LifecycleThread worker(1000000);
+
+        if (worker.tid() != 0 || !worker.set_name("vms-test-worker-truncated"))
+        {
+            std::cerr << "[ThreadName] Idle worker has a tid or rejected the name\n";
+            return false;
+        }
+
+        if (worker.name() != "vms-test-worker")
+        {
+            std::cerr << "[ThreadName] Name not truncated to 15 characters: " << worker.name() << '\n';
+            return false;
+        }
+
+        if (!worker.start())
+        {
+            std::cerr << "[ThreadName] Unable to start worker\n";
+            return false;
+        }
+
+        const bool ran = wait_for_condition(
+            [&]() { return worker.run_calls() >= 1; }, std::chrono::milliseconds(500));
+
+        const pid_t tid = worker.tid();
+        const std::string initial = read_thread_comm(tid);
+        const bool renamed = worker.set_name("vms-renamed");
+        const std::string after_rename = read_thread_comm(tid);
+
+        worker.stop();
+
+        if (!ran || tid <= 0 || tid == gettid())
+        {
+            std::cerr << "[ThreadName] Running worker reported tid " << tid << '\n';
+            return false;
+        }
+
+        if (initial != "vms-test-worker" || !renamed || after_rename != "vms-renamed")
+        {
+            std::cerr << "[ThreadName] Kernel sees '" << initial << "' then '" << after_rename << "'\n";
+            return false;
+        }
+
+        if (worker.tid() != 0)
+        {
+            std::cerr << "[ThreadName] Stopped worker still reports a tid\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_thread_registry()
+    {
+        LifecycleThread first(1000000);
+        LifecycleThread second(1000000);
+        first.set_name("registry-one");
+        second.set_name("registry-two");
+
+        std::vector<vms::core::ThreadInfo> infos;
+        vms::core::ThreadRegistry::snapshot(infos);
+        const std::size_t baseline = infos.size();
+
+        if (!first.start() || !second.start())
+        {
+            std::cerr << "[ThreadRegistry] Unable to start workers\n";
+            return false;
+        }
+
+        const bool ran = wait_for_condition(
+            [&]() { return first.run_calls() >= 5 && second.run_calls() >= 5; }, std::chrono::milliseconds(1000));
+
+        vms::core::ThreadRegistry::snapshot(infos);
+
+        const pid_t first_tid = first.tid();
+        const vms::core::ThreadInfo* found = nullptr;
+        std::size_t matches = 0;
+
+        for (const auto& info : infos)
+        {
+            if (info.thread == &first)
+            {
+                found = &info;
+            }
+
+            matches += (info.thread == &first || info.thread == &second) ? 1 : 0;
+        }
+
+        first.stop();
+        second.stop();
+
+        if (!ran || found == nullptr || matches != 2 || infos.size() != baseline + 2)
+        {
+            std::cerr << "[ThreadRegistry] Running workers missing from the snapshot\n";
+            return false;
+        }
+
+        if (found->tid != first_tid || found->state != vms::core::ThreadState::RUNNING ||
+            std::string(found->name) != "registry-one" || found->iterations < 4)
+        {
+            std::cerr << "[ThreadRegistry] Unexpected entry: tid " << found->tid << ", name " << found->name
+                      << ", iterations " << found->iterations << '\n';
+            return false;
+        }
+
+        // Every iteration sleeps, so the worker must have yielded the CPU.
+        if (found->cpu_time.count() <= 0 || found->voluntary_switches == 0)
+        {
+            std::cerr << "[ThreadRegistry] Missing CPU time or context switches\n";
+            return false;
+        }
+
+        vms::core::ThreadRegistry::snapshot(infos);
+
+        for (const auto& info : infos)
+        {
+            if (info.thread == &first || info.thread == &second)
+            {
+                std::cerr << "[ThreadRegistry] Stopped worker still registered\n";
+                return false;
+            }
+        }
+
+        return vms::core::ThreadRegistry::dropped() == 0;
+    }
+
     bool test_set_process_priority()
     {
         const int invalid_priority = sched_get_priority_max(SCHED_FIFO) + 1;
@@ -386,9 +1795,31 @@ int main()
     const TestEntry tests[] = {
         {"Thread lifecycle", &test_thread_lifecycle},
         {"Thread init failure", &test_thread_init_failure},
+        {"Thread lifecycle state", &test_thread_lifecycle_state},
+        {"Thread start/stop race", &test_thread_start_stop_race},
+        {"Thread stop all", &test_thread_stop_all},
+        {"Thread affinity", &test_thread_affinity},
+        {"Thread scheduling", &test_thread_scheduling},
+        {"Thread name", &test_thread_name},
+        {"Thread registry", &test_thread_registry},
         {"Thread set process priority", &test_set_process_priority},
         {"TimedThread interval", &test_timed_thread_interval},
         {"HiResTimedThread interval", &test_hires_timed_thread_interval},
+        {"HiResTimedThread hybrid precision", &test_hires_timed_thread_hybrid_precision},
+        {"HiResTimedThread timerfd interval", &test_hires_timed_thread_timerfd_interval},
+        {"HiResTimedThread missed ticks", &test_hires_timed_thread_missed_ticks},
+        {"HiResTimedThread overrun policies", &test_hires_timed_thread_overrun_policies},
+        {"LogLinearBuckets bounds", &test_log_linear_buckets},
+        {"HiResTimedThread statistics", &test_hires_timed_thread_statistics},
+        {"TimedThread stop latency", &test_timed_thread_stop_latency},
+        {"HiResTimedThread stop latency", &test_hires_timed_thread_stop_latency},
+        {"TimedThread wake", &test_timed_thread_wake},
+        {"EventThread notify", &test_event_thread_notify},
+        {"PollingThread idle strategies", &test_polling_thread_idle_strategies},
+        {"BatchedThread", &test_batched_thread},
+        {"StaticThread", &test_static_thread},
+        {"StaticThread mixins", &test_static_thread_mixins},
+        {"StaticThread join handle", &test_static_thread_join_handle},
     };
 
     bool all_passed = true;
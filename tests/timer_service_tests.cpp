@@ -0,0 +1,270 @@
+#include <vms/core/thread_pool.h>
+#include <vms/core/timer_service.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Poll @p done until it returns true or @p timeout elapses. */
+    template <typename Predicate>
+    bool wait_until(Predicate done, std::chrono::milliseconds timeout = std::chrono::milliseconds(5000))
+    {
+        const auto deadline = Clock::now() + timeout;
+
+        while (!done())
+        {
+            if (Clock::now() >= deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    bool test_timer_service_one_shot()
+    {
+        // 5us ticks: the 400ms timer starts on the third wheel level and is cascaded twice.
+        vms::core::TimerService service(5);
+        service.start();
+
+        const std::array<std::chrono::microseconds, 4> delays{
+            std::chrono::microseconds(50), std::chrono::microseconds(2000),
+            std::chrono::microseconds(30000), std::chrono::microseconds(400000)};
+        std::array<std::atomic<int64_t>, 4> fired_after_us{};
+        std::atomic<int> fired{0};
+
+        const auto begin = Clock::now();
+
+        for (std::size_t i = 0; i < delays.size(); ++i)
+        {
+            fired_after_us[i].store(-1);
+            const auto id = service.schedule_after(delays[i], [&, i] {
+                fired_after_us[i].store(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count());
+                fired.fetch_add(1);
+            });
+
+            if (id == vms::core::TimerService::INVALID_TIMER)
+            {
+                std::cerr << "[TimerServiceOneShot] Schedule failed\n";
+                return false;
+            }
+        }
+
+        if (!wait_until([&] { return fired.load() == 4; }))
+        {
+            std::cerr << "[TimerServiceOneShot] Only " << fired.load() << " timers fired\n";
+            return false;
+        }
+
+        for (std::size_t i = 0; i < delays.size(); ++i)
+        {
+            if (fired_after_us[i].load() < delays[i].count())
+            {
+                std::cerr << "[TimerServiceOneShot] Timer " << i << " fired early after "
+                          << fired_after_us[i].load() << "us\n";
+                return false;
+            }
+        }
+
+        if (!wait_until([&] { return service.active_timers() == 0; }))
+        {
+            std::cerr << "[TimerServiceOneShot] Fired timers still active\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_timer_service_periodic_cancel()
+    {
+        vms::core::TimerService service(100);
+        service.start();
+
+        std::atomic<int> periodic{0};
+        std::atomic<int> cancelled_runs{0};
+        std::atomic<int> self_cancelling{0};
+
+        const auto periodic_id = service.schedule_every(std::chrono::milliseconds(1), [&] { periodic.fetch_add(1); });
+        const auto cancelled_id =
+            service.schedule_after(std::chrono::milliseconds(50), [&] { cancelled_runs.fetch_add(1); });
+
+        vms::core::TimerService::TimerId self_id = vms::core::TimerService::INVALID_TIMER;
+        std::atomic<bool> self_id_ready{false};
+        self_id = service.schedule_every(std::chrono::milliseconds(1), [&] {
+            if (self_id_ready.load() && self_cancelling.fetch_add(1) + 1 == 3)
+            {
+                service.cancel(self_id);
+            }
+        });
+        self_id_ready.store(true);
+
+        if (!service.cancel(cancelled_id) || service.cancel(cancelled_id))
+        {
+            std::cerr << "[TimerServicePeriodicCancel] Cancel of a pending timer misreported\n";
+            return false;
+        }
+
+        if (!wait_until([&] { return periodic.load() >= 10; }))
+        {
+            std::cerr << "[TimerServicePeriodicCancel] Periodic timer ran " << periodic.load() << " times\n";
+            return false;
+        }
+
+        if (!service.cancel(periodic_id))
+        {
+            std::cerr << "[TimerServicePeriodicCancel] Cancel of a periodic timer failed\n";
+            return false;
+        }
+
+        const int after_cancel = periodic.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+
+        // At most one invocation may have been in flight when cancel() returned.
+        if (periodic.load() > after_cancel + 1 || cancelled_runs.load() != 0 || self_cancelling.load() != 3)
+        {
+            std::cerr << "[TimerServicePeriodicCancel] Cancelled timers kept running (periodic "
+                      << periodic.load() - after_cancel << ", one-shot " << cancelled_runs.load()
+                      << ", self " << self_cancelling.load() << ")\n";
+            return false;
+        }
+
+        if (service.active_timers() != 0 || service.cancel(self_id))
+        {
+            std::cerr << "[TimerServicePeriodicCancel] Cancelled timers still alive\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_timer_service_many_timers()
+    {
+        constexpr int timer_count = 100000;
+
+        vms::core::TimerService service(1000, timer_count);
+        std::atomic<int> fired{0};
+        std::atomic<int> early{0};
+        std::vector<vms::core::TimerService::TimerId> ids;
+        ids.reserve(timer_count);
+
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> delay_ms(1, 300);
+
+        for (int i = 0; i < timer_count; ++i)
+        {
+            const auto delay = std::chrono::milliseconds(delay_ms(rng));
+            const auto due = Clock::now() + delay;
+
+            ids.push_back(service.schedule_after(delay, [&fired, &early, due] {
+                early.fetch_add(Clock::now() < due ? 1 : 0);
+                fired.fetch_add(1);
+            }));
+        }
+
+        if (service.schedule_after(std::chrono::milliseconds(1), [] {}) != vms::core::TimerService::INVALID_TIMER)
+        {
+            std::cerr << "[TimerServiceManyTimers] Schedule beyond max_timers succeeded\n";
+            return false;
+        }
+
+        for (int i = 0; i < timer_count; i += 2)
+        {
+            service.cancel(ids[static_cast<std::size_t>(i)]);
+        }
+
+        service.start();
+
+        if (!wait_until([&] { return service.active_timers() == 0; }))
+        {
+            std::cerr << "[TimerServiceManyTimers] " << service.active_timers() << " timers never fired\n";
+            return false;
+        }
+
+        if (fired.load() != timer_count / 2 || early.load() != 0)
+        {
+            std::cerr << "[TimerServiceManyTimers] Expected " << timer_count / 2 << " callbacks, got " << fired.load()
+                      << " (" << early.load() << " early)\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_timer_service_pool_dispatch()
+    {
+        vms::core::ThreadPool pool(2);
+        pool.start();
+
+        std::atomic<int> on_pool{0};
+        std::atomic<int> off_pool{0};
+
+        {
+            vms::core::TimerService service(200);
+            service.set_dispatch_pool(&pool);
+            service.start();
+
+            service.schedule_every(std::chrono::milliseconds(1), [&] {
+                (vms::core::ThreadPool::on_worker() ? on_pool : off_pool).fetch_add(1);
+            });
+
+            if (!wait_until([&] { return on_pool.load() >= 5; }))
+            {
+                std::cerr << "[TimerServicePoolDispatch] Periodic timer ran " << on_pool.load() << " times on the pool\n";
+                return false;
+            }
+        }
+
+        if (off_pool.load() != 0)
+        {
+            std::cerr << "[TimerServicePoolDispatch] " << off_pool.load() << " callbacks ran off the pool\n";
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"TimerService one-shot", &test_timer_service_one_shot},
+        {"TimerService periodic and cancel", &test_timer_service_periodic_cancel},
+        {"TimerService many timers", &test_timer_service_many_timers},
+        {"TimerService pool dispatch", &test_timer_service_pool_dispatch},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+#include <vms/core/thread_worker.h>
+#include <vms/core/triple_buffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using TestClock = std::chrono::steady_clock;
+    using Frame = std::vector<uint64_t>;
+
+    constexpr std::size_t frame_words = 4096;
+
+    template <typename Predicate>
+    bool wait_for_condition(Predicate&& predicate, std::chrono::milliseconds timeout)
+    {
+        const auto deadline = TestClock::now() + timeout;
+
+        while (!predicate())
+        {
+            if (TestClock::now() >= deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    /** @brief Every word holds the frame number: a frame shared with the writer shows mixed values. */
+    bool consistent(const Frame& frame)
+    {
+        for (const uint64_t word : frame)
+        {
+            if (word != frame[0])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /** @brief Consumer taking the newest frame whenever the producer notifies it. */
+    class FrameConsumer : public vms::core::PollingThread
+    {
+    public:
+        explicit FrameConsumer(vms::core::TripleBuffer<Frame>& frames) : frames_(frames) {}
+
+        ~FrameConsumer() override
+        {
+            stop();
+        }
+
+        uint64_t last_frame() const { return last_frame_.load(); }
+        int failures() const { return failures_.load(); }
+        int frames_seen() const { return frames_seen_.load(); }
+
+    protected:
+        bool poll() override
+        {
+            if (!frames_.update())
+            {
+                return false;
+            }
+
+            const Frame& frame = frames_.read_buffer();
+
+            if (!consistent(frame) || frame[0] <= last_frame_.load())
+            {
+                failures_.fetch_add(1);
+            }
+
+            last_frame_.store(frame[0]);
+            frames_seen_.fetch_add(1);
+            return true;
+        }
+
+    private:
+        vms::core::TripleBuffer<Frame>& frames_;
+        std::atomic<uint64_t> last_frame_{0};
+        std::atomic<int> failures_{0};
+        std::atomic<int> frames_seen_{0};
+    };
+
+    bool test_triple_buffer_latest_value()
+    {
+        vms::core::TripleBuffer<int> buffer;
+
+        if (buffer.update() || buffer.has_update())
+        {
+            std::cerr << "[TripleBuffer] Update reported before any publish\n";
+            return false;
+        }
+
+        buffer.write_buffer() = 1;
+        const bool first_dropped = buffer.publish();
+        buffer.write_buffer() = 2;
+        const bool second_dropped = buffer.publish();
+
+        if (first_dropped || !second_dropped || !buffer.has_update())
+        {
+            std::cerr << "[TripleBuffer] Dirty flag not tracked by publish()\n";
+            return false;
+        }
+
+        if (!buffer.update() || buffer.read_buffer() != 2 || buffer.update() || buffer.read_buffer() != 2)
+        {
+            std::cerr << "[TripleBuffer] Reader did not get the latest value exactly once\n";
+            return false;
+        }
+
+        buffer.write_buffer() = 3;
+        buffer.publish();
+
+        if (!buffer.update() || buffer.read_buffer() != 3)
+        {
+            std::cerr << "[TripleBuffer] Value published after a read was lost\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_triple_buffer_in_place()
+    {
+        // Buffers are allocated once and rotate: no reallocation per frame.
+        vms::core::TripleBuffer<Frame> frames(frame_words, uint64_t{0});
+        const uint64_t* allocations[3] = {};
+
+        for (int i = 0; i < 3; ++i)
+        {
+            Frame& frame = frames.write_buffer();
+            allocations[i] = frame.data();
+            frame.assign(frame_words, static_cast<uint64_t>(i + 1));
+            frames.publish();
+            frames.update();
+
+            if (frames.read_buffer().size() != frame_words || !consistent(frames.read_buffer()))
+            {
+                std::cerr << "[TripleBufferInPlace] Frame " << i << " corrupted\n";
+                return false;
+            }
+        }
+
+        if (allocations[0] == allocations[1] || allocations[1] == allocations[2] || allocations[0] == allocations[2])
+        {
+            std::cerr << "[TripleBufferInPlace] Writer did not rotate over three buffers\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_triple_buffer_thread_handoff()
+    {
+        vms::core::TripleBuffer<Frame> frames(frame_words, uint64_t{0});
+        FrameConsumer consumer(frames);
+        consumer.start();
+
+        constexpr uint64_t frame_count = 20000;
+
+        for (uint64_t i = 1; i <= frame_count; ++i)
+        {
+            Frame& frame = frames.write_buffer();
+            std::fill(frame.begin(), frame.end(), i);
+            frames.publish();
+            consumer.notify();
+
+            if ((i & 63) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        const bool caught_up = wait_for_condition(
+            [&] { return consumer.last_frame() == frame_count; }, std::chrono::milliseconds(1000));
+        consumer.stop();
+
+        if (!caught_up || consumer.failures() != 0 || consumer.frames_seen() == 0)
+        {
+            std::cerr << "[TripleBufferHandoff] Last frame " << consumer.last_frame() << ", "
+                      << consumer.failures() << " torn or stale frames out of " << consumer.frames_seen() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"TripleBuffer latest value", &test_triple_buffer_latest_value},
+        {"TripleBuffer in-place buffers", &test_triple_buffer_in_place},
+        {"TripleBuffer Thread handoff", &test_triple_buffer_thread_handoff},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+#include <vms/core/watchdog.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using TestClock = std::chrono::steady_clock;
+
+    template <typename Predicate>
+    bool wait_for_condition(Predicate&& predicate, std::chrono::milliseconds timeout)
+    {
+        const auto deadline = TestClock::now() + timeout;
+
+        while (!predicate())
+        {
+            if (TestClock::now() >= deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    /** @brief Worker whose run() blocks while the gate is closed. */
+    class BlockingThread : public vms::core::Thread
+    {
+    public:
+        ~BlockingThread() override
+        {
+            stop();
+        }
+
+        void block() { blocked_.store(true); }
+        void unblock() { blocked_.store(false); }
+        int run_calls() const { return run_calls_.load(); }
+
+    protected:
+        void run() override
+        {
+            run_calls_.fetch_add(1);
+
+            while (blocked_.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+    private:
+        std::atomic<bool> blocked_{false};
+        std::atomic<int> run_calls_{0};
+    };
+
+    /** @brief Worker sleeping far longer than any budget, but outside run(). */
+    class SleepyTimedThread : public vms::core::TimedThread
+    {
+    public:
+        SleepyTimedThread()
+            : TimedThread(300000)
+        {
+        }
+
+        ~SleepyTimedThread() override
+        {
+            stop();
+        }
+
+    protected:
+        void run() override
+        {
+        }
+    };
+
+    bool test_watchdog_reports_stall()
+    {
+        std::mutex reports_mutex;
+        std::vector<vms::core::StallReport> reports;
+
+        vms::core::Watchdog watchdog(
+            [&](const vms::core::StallReport& report) {
+                std::lock_guard<std::mutex> lock(reports_mutex);
+                reports.push_back(report);
+            },
+            std::chrono::milliseconds(40), 2000);
+
+        BlockingThread stuck;
+        BlockingThread healthy;
+        SleepyTimedThread sleepy;
+        stuck.set_name("stuck-worker");
+
+        watchdog.start();
+        stuck.start();
+        healthy.start();
+        sleepy.start();
+
+        wait_for_condition([&] { return stuck.run_calls() >= 3; }, std::chrono::milliseconds(1000));
+
+        const auto blocked_at = TestClock::now();
+        stuck.block();
+
+        const bool reported = wait_for_condition([&] { return watchdog.stall_count() >= 1; }, std::chrono::milliseconds(2000));
+        const auto reported_after = TestClock::now() - blocked_at;
+
+        // Stay blocked a while longer: the same iteration must not be reported twice.
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        stuck.unblock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const pid_t stuck_tid = stuck.tid();
+        watchdog.stop();
+
+        std::lock_guard<std::mutex> lock(reports_mutex);
+
+        if (!reported || reports.size() != 1)
+        {
+            std::cerr << "[WatchdogReportsStall] Expected one report, got " << reports.size() << '\n';
+            return false;
+        }
+
+        const auto& report = reports.front();
+
+        if (report.thread != &stuck || report.tid != stuck_tid || std::strcmp(report.name, "stuck-worker") != 0)
+        {
+            std::cerr << "[WatchdogReportsStall] Report names '" << report.name << "' tid " << report.tid << '\n';
+            return false;
+        }
+
+        if (report.stuck_for < std::chrono::milliseconds(40) || report.stuck_for > reported_after)
+        {
+            std::cerr << "[WatchdogReportsStall] Stuck time "
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(report.stuck_for).count() << "ms\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool test_watchdog_per_thread_budget()
+    {
+        std::atomic<int> reports{0};
+
+        vms::core::Watchdog watchdog([&](const vms::core::StallReport&) { reports.fetch_add(1); },
+                                     std::chrono::milliseconds(20), 2000);
+
+        BlockingThread exempt;
+        exempt.set_watchdog_budget(std::chrono::nanoseconds::max());
+
+        BlockingThread tolerant;
+        tolerant.set_watchdog_budget(std::chrono::seconds(10));
+
+        watchdog.start();
+        exempt.start();
+        tolerant.start();
+
+        wait_for_condition([&] { return exempt.run_calls() >= 1 && tolerant.run_calls() >= 1; },
+                           std::chrono::milliseconds(1000));
+
+        exempt.block();
+        tolerant.block();
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+        // Lowering the budget of a running thread applies at the next scan.
+        tolerant.set_watchdog_budget(std::chrono::milliseconds(20));
+        const bool reported = wait_for_condition([&] { return reports.load() == 1; }, std::chrono::milliseconds(1000));
+
+        exempt.unblock();
+        tolerant.unblock();
+        watchdog.stop();
+
+        if (!reported || reports.load() != 1)
+        {
+            std::cerr << "[WatchdogPerThreadBudget] Expected one report, got " << reports.load() << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    struct TestEntry
+    {
+        const char* name;
+        bool (*func)();
+    };
+
+    const TestEntry tests[] = {
+        {"Watchdog reports stall", &test_watchdog_reports_stall},
+        {"Watchdog per-thread budget", &test_watchdog_per_thread_budget},
+    };
+
+    bool all_passed = true;
+
+    for (const auto& test : tests)
+    {
+        if (!test.func())
+        {
+            std::cerr << "Test FAILED: " << test.name << '\n';
+            all_passed = false;
+        }
+        else
+        {
+            std::cout << "Test passed: " << test.name << '\n';
+        }
+    }
+
+    return all_passed ? 0 : 1;
+}
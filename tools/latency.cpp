@@ -0,0 +1,370 @@
+/*
+    Library Utilities - Copyright (C) 2025 Manuel Virgilio
+    This file is part of a project licensed under the terms
+    of the LGPLv3 + Attribution. See LICENSE for details.
+*/
+
+// Usage: vms-core-latency [-t threads] [-i interval_us] [-d distance_us]
+//                         [-y other|fifo|rr] [-p priority] [-a cpu,cpu,...]
+//                         [-P sleep|hybrid] [-b steady|timerfd] [-D seconds] [-m]
+//
+// cyclictest-style host qualification using the timing code we deploy:
+// spawns N HiResTimedThread loops with an empty run() and reports, per
+// thread, the wake-up latency (actual start of run() minus its scheduled
+// slot) collected by LoopStatistics, followed by an ASCII histogram.
+//
+//   -t  number of threads (1)
+//   -i  period of the first thread in microseconds (1000)
+//   -d  period increment for each following thread (500)
+//   -y  scheduling policy (other)
+//   -p  priority for fifo/rr, nice value for other (0)
+//   -a  CPUs to pin to, assigned round-robin (unpinned)
+//   -P  HiResTimedThread precision (sleep)
+//   -b  HiResTimedThread time source (steady)
+//   -D  duration in seconds, 0 runs until SIGINT/SIGTERM (10)
+//   -m  lock current and future memory (mlockall)
+
+#include <vms/core/loop_statistics.h>
+#include <vms/core/thread_worker.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    using vms::core::LogLinearBuckets;
+    using vms::core::LoopStatisticsSnapshot;
+
+    constexpr int histogram_width = 50;
+
+    std::atomic<bool> interrupted{false};
+
+    void on_signal(int)
+    {
+        interrupted.store(true, std::memory_order_relaxed);
+    }
+
+    struct Options
+    {
+        int threads = 1;
+        int interval_us = 1000;
+        int distance_us = 500;
+        vms::core::ThreadSchedulingPolicy policy = vms::core::ThreadSchedulingPolicy::OTHER;
+        int priority = 0;
+        std::vector<int> cpus;
+        vms::core::TimerPrecision precision = vms::core::TimerPrecision::SLEEP;
+        vms::core::TimerBackend backend = vms::core::TimerBackend::STEADY_CLOCK;
+        int duration_s = 10;
+        bool lock_memory = false;
+    };
+
+    /** @brief Empty periodic loop: everything measured comes from the built-in statistics. */
+    class LatencyThread : public vms::core::HiResTimedThread
+    {
+    public:
+        explicit LatencyThread(int32_t micro_sec) : vms::core::HiResTimedThread(micro_sec) {}
+        ~LatencyThread() override { stop(); }
+
+    protected:
+        void run() override {}
+    };
+
+    /** @brief Period of thread @p idx in microseconds; 64-bit so the sum cannot overflow. */
+    int64_t thread_interval_us(const Options& options, int idx)
+    {
+        return static_cast<int64_t>(options.interval_us) + static_cast<int64_t>(idx) * options.distance_us;
+    }
+
+    void print_usage(const char* program)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s [-t threads] [-i interval_us] [-d distance_us] [-y other|fifo|rr]\n"
+                     "       [-p priority] [-a cpu,cpu,...] [-P sleep|hybrid] [-b steady|timerfd]\n"
+                     "       [-D seconds] [-m]\n",
+                     program);
+    }
+
+    /** @brief Parse a decimal integer in [min, max]; false on garbage or out of range. */
+    bool parse_int(const char* text, int min, int max, int& value)
+    {
+        char* end = nullptr;
+        const long parsed = std::strtol(text, &end, 10);
+
+        if (end == text || *end != '\0' || parsed < min || parsed > max)
+        {
+            return false;
+        }
+
+        value = static_cast<int>(parsed);
+        return true;
+    }
+
+    bool parse_cpus(const char* text, std::vector<int>& cpus)
+    {
+        std::string list(text);
+        std::size_t begin = 0;
+
+        while (begin <= list.size())
+        {
+            const std::size_t end = std::min(list.find(',', begin), list.size());
+            int cpu = 0;
+
+            if (!parse_int(list.substr(begin, end - begin).c_str(), 0, CPU_SETSIZE - 1, cpu))
+            {
+                return false;
+            }
+
+            cpus.push_back(cpu);
+            begin = end + 1;
+        }
+
+        return !cpus.empty();
+    }
+
+    bool parse_options(int argc, char** argv, Options& options)
+    {
+        int opt = 0;
+
+        while ((opt = getopt(argc, argv, "t:i:d:y:p:a:P:b:D:m")) != -1)
+        {
+            bool valid = true;
+
+            switch (opt)
+            {
+            case 't': valid = parse_int(optarg, 1, 4096, options.threads); break;
+            case 'i': valid = parse_int(optarg, 1, 10000000, options.interval_us); break;
+            case 'd': valid = parse_int(optarg, 0, 10000000, options.distance_us); break;
+            case 'p': valid = parse_int(optarg, -20, 99, options.priority); break;
+            case 'a': valid = parse_cpus(optarg, options.cpus); break;
+            case 'D': valid = parse_int(optarg, 0, 86400 * 365, options.duration_s); break;
+            case 'm': options.lock_memory = true; break;
+            case 'y':
+                if (std::strcmp(optarg, "other") == 0)
+                {
+                    options.policy = vms::core::ThreadSchedulingPolicy::OTHER;
+                }
+                else if (std::strcmp(optarg, "fifo") == 0)
+                {
+                    options.policy = vms::core::ThreadSchedulingPolicy::FIFO;
+                }
+                else if (std::strcmp(optarg, "rr") == 0)
+                {
+                    options.policy = vms::core::ThreadSchedulingPolicy::RR;
+                }
+                else
+                {
+                    valid = false;
+                }
+                break;
+            case 'P':
+                valid = std::strcmp(optarg, "sleep") == 0 || std::strcmp(optarg, "hybrid") == 0;
+                options.precision = (std::strcmp(optarg, "hybrid") == 0) ? vms::core::TimerPrecision::HYBRID
+                                                                         : vms::core::TimerPrecision::SLEEP;
+                break;
+            case 'b':
+                valid = std::strcmp(optarg, "steady") == 0 || std::strcmp(optarg, "timerfd") == 0;
+                options.backend = (std::strcmp(optarg, "timerfd") == 0) ? vms::core::TimerBackend::TIMERFD
+                                                                        : vms::core::TimerBackend::STEADY_CLOCK;
+                break;
+            default: valid = false; break;
+            }
+
+            if (!valid)
+            {
+                return false;
+            }
+        }
+
+        // HiResTimedThread takes the period as int32_t microseconds.
+        if (thread_interval_us(options, options.threads - 1) > std::numeric_limits<int32_t>::max())
+        {
+            std::fprintf(stderr, "interval + (threads - 1) * distance exceeds %d us\n",
+                         std::numeric_limits<int32_t>::max());
+            return false;
+        }
+
+        return optind == argc;
+    }
+
+    const char* policy_name(vms::core::ThreadSchedulingPolicy policy)
+    {
+        switch (policy)
+        {
+        case vms::core::ThreadSchedulingPolicy::FIFO: return "fifo";
+        case vms::core::ThreadSchedulingPolicy::RR: return "rr";
+        default: return "other";
+        }
+    }
+
+    /** @brief One row per power-of-two latency range, between the first and last non-empty one. */
+    void print_histogram(const LoopStatisticsSnapshot& snapshot)
+    {
+        constexpr std::size_t octave = LogLinearBuckets::SUB_BUCKET_COUNT;
+        constexpr std::size_t rows = LogLinearBuckets::BUCKET_COUNT / octave;
+
+        std::vector<uint64_t> counts(rows, 0);
+
+        for (std::size_t idx = 0; idx < snapshot.wakeup_histogram.size(); ++idx)
+        {
+            counts[idx / octave] += snapshot.wakeup_histogram[idx];
+        }
+
+        const auto first = std::find_if(counts.begin(), counts.end(), [](uint64_t count) { return count != 0; });
+
+        if (first == counts.end())
+        {
+            return;
+        }
+
+        const auto last = std::find_if(counts.rbegin(), counts.rend(), [](uint64_t count) { return count != 0; });
+        const uint64_t peak = *std::max_element(counts.begin(), counts.end());
+
+        for (auto row = first; row != last.base(); ++row)
+        {
+            const auto idx = static_cast<std::size_t>(row - counts.begin());
+            const double low_us = static_cast<double>(LogLinearBuckets::lower_bound(idx * octave)) / 1000.0;
+            const double high_us = static_cast<double>(LogLinearBuckets::upper_bound(idx * octave + octave - 1)) / 1000.0;
+
+            // Any non-empty range gets at least one mark, outliers must stay visible.
+            int width = static_cast<int>(static_cast<double>(*row) * histogram_width / static_cast<double>(peak));
+            if (*row != 0)
+            {
+                width = std::max(width, 1);
+            }
+
+            std::printf("    %10.3f - %10.3f us |%-*s| %llu\n", low_us, high_us, histogram_width,
+                        std::string(static_cast<std::size_t>(width), '#').c_str(),
+                        static_cast<unsigned long long>(*row));
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if (!parse_options(argc, argv, options))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (options.lock_memory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        std::fprintf(stderr, "mlockall failed: %s\n", std::strerror(errno));
+    }
+
+    struct sigaction action{};
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    std::vector<std::unique_ptr<LatencyThread>> threads;
+    vms::core::ThreadScheduling scheduling;
+    scheduling.policy = options.policy;
+
+    if (options.policy == vms::core::ThreadSchedulingPolicy::OTHER)
+    {
+        scheduling.nice = options.priority;
+    }
+    else
+    {
+        scheduling.priority = options.priority;
+    }
+
+    for (int i = 0; i < options.threads; ++i)
+    {
+        auto thread = std::make_unique<LatencyThread>(static_cast<int32_t>(thread_interval_us(options, i)));
+        thread->set_name("latency/" + std::to_string(i));
+        thread->set_precision(options.precision);
+        thread->set_backend(options.backend);
+        thread->set_scheduling(scheduling);
+
+        if (!options.cpus.empty())
+        {
+            thread->set_affinity(options.cpus[static_cast<std::size_t>(i) % options.cpus.size()]);
+        }
+
+        thread->enable_statistics();
+        threads.push_back(std::move(thread));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread->start();
+    }
+
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(options.duration_s);
+
+    while (!interrupted.load(std::memory_order_relaxed)
+           && (options.duration_s == 0 || std::chrono::steady_clock::now() < end))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    // Snapshots are taken while running so every thread covers the same window.
+    std::vector<LoopStatisticsSnapshot> snapshots;
+    snapshots.reserve(threads.size());
+
+    for (auto& thread : threads)
+    {
+        snapshots.push_back(thread->statistics());
+    }
+
+    for (auto& thread : threads)
+    {
+        thread->request_stop();
+    }
+
+    for (std::size_t i = 0; i < threads.size(); ++i)
+    {
+        LatencyThread& thread = *threads[i];
+        const LoopStatisticsSnapshot& snapshot = snapshots[i];
+        const auto& latency = snapshot.wakeup_latency;
+        int cpu = -1;
+
+        if (!options.cpus.empty())
+        {
+            cpu = options.cpus[i % options.cpus.size()];
+        }
+
+        std::printf("T:%2zu (%s) policy %s/%d cpu %d interval %lld us, %llu samples\n", i, thread.name().c_str(),
+                    policy_name(options.policy), options.priority, cpu,
+                    static_cast<long long>(thread_interval_us(options, static_cast<int>(i))),
+                    static_cast<unsigned long long>(latency.count));
+
+        if (thread.scheduling_error() != 0 || (cpu >= 0 && thread.affinity_error() != 0))
+        {
+            std::printf("    warning: scheduling error %d, affinity error %d (requested settings not applied)\n",
+                        thread.scheduling_error(), thread.affinity_error());
+        }
+
+        std::printf("    min %10.3f us  avg %10.3f us  max %10.3f us  p99.99 <= %10.3f us  overruns %llu\n",
+                    static_cast<double>(latency.min) / 1000.0, latency.mean() / 1000.0,
+                    static_cast<double>(latency.max) / 1000.0,
+                    static_cast<double>(snapshot.wakeup_percentile(0.9999)) / 1000.0,
+                    static_cast<unsigned long long>(thread.overrun_count()));
+
+        print_histogram(snapshot);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread->stop();
+    }
+
+    return 0;
+}